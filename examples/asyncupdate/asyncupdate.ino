@@ -0,0 +1,55 @@
+/*
+  Async Update Example for ST7315 OLED Display
+
+  This example demonstrates the non-blocking flush of the
+  Arduino_ST7315 library: endDraw() only starts the transfer
+  and loop() keeps sampling while the frame is sent in small chunks.
+*/
+
+#include "Arduino_ST7315.h"
+
+#define SCREEN_WIDTH    128     // OLED display width, in pixels
+#define SCREEN_HEIGHT   64      // OLED display height, in pixels
+#define SCREEN_ADDRESS  0x3D    // I2C address for the ST7315
+
+Arduino_ST7315 Display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire1, SCREEN_ADDRESS);
+
+unsigned long frames  = 0;
+unsigned long samples = 0;
+
+void frameSent() {
+    frames++;
+}
+
+void setup() {
+    Serial.begin(115200);
+
+    if (!Display.begin()) {
+        Serial.println("ST7315 Display allocation failed");
+        while (1) ;
+    }
+
+    Display.setAsyncUpdate(true);
+    Display.onUpdateComplete(frameSent);
+    Display.textFont(Font_5x7);
+    Display.stroke(255, 255, 255);
+    Display.background(0, 0, 0);
+}
+
+void loop() {
+    if (!Display.isBusy()) {
+        char str[24];
+        sprintf(str, "A0: %4d", analogRead(A0));
+
+        Display.beginDraw();
+        Display.text(str, 0, 0);
+        sprintf(str, "samples: %lu", samples);
+        Display.text(str, 0, 10);
+        Display.endDraw();      // Starts the transfer and returns immediately
+    }
+
+    // Send at most 1 ms worth of frame data, then go back to work
+    Display.poll(0, 1000);
+
+    samples++;
+}
@@ -0,0 +1,58 @@
+/*
+  Band Draw Example for ST7315 OLED Display
+
+  This example demonstrates the page-band mode of the
+  low-level Arduino_ST7315_Driver class: instead of a 1 KB
+  framebuffer the driver keeps one band of 2 pages (256 bytes)
+  and the frame is drawn band by band, each band being sent
+  as soon as it is drawn. Useful on boards with little RAM.
+*/
+
+#include "Arduino_ST7315_Driver.h"
+
+#define SCREEN_WIDTH    128     // OLED display width, in pixels
+#define SCREEN_HEIGHT   64      // OLED display height, in pixels
+#define SCREEN_ADDRESS  0x3D    // I2C address for the ST7315
+#define BAND_PAGES      2       // 8 rows per page, 128 bytes per page
+
+Arduino_ST7315_Driver Display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire1, SCREEN_ADDRESS);
+
+int ballX = 10;
+int ballY = 10;
+int dx = 2;
+int dy = 1;
+
+// Called once per band: drawing outside the band is clipped away
+void drawFrame() {
+    // Border
+    Display.drawHLine(0, 0, SCREEN_WIDTH, true);
+    Display.drawHLine(0, SCREEN_HEIGHT - 1, SCREEN_WIDTH, true);
+    Display.drawVLine(0, 0, SCREEN_HEIGHT, true);
+    Display.drawVLine(SCREEN_WIDTH - 1, 0, SCREEN_HEIGHT, true);
+
+    // Ball
+    Display.fillRect(ballX, ballY, 8, 8, true);
+}
+
+void setup() {
+    Serial.begin(115200);
+
+    // Must be set before begin(), which allocates the band buffer
+    Display.setBandPages(BAND_PAGES);
+
+    if (!Display.begin()) {
+        Serial.println("ST7315 Driver initialization failed");
+        while (1);
+    }
+}
+
+void loop() {
+    Display.drawBands(drawFrame);
+
+    ballX += dx;
+    ballY += dy;
+    if (ballX <= 1 || ballX >= SCREEN_WIDTH - 9) dx = -dx;
+    if (ballY <= 1 || ballY >= SCREEN_HEIGHT - 9) dy = -dy;
+
+    delay(10);
+}
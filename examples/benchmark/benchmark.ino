@@ -0,0 +1,213 @@
+/*
+  Benchmark for ST7315 OLED Display
+
+  This example measures the rendering time of the shapes drawn by
+  the testgraphics example, comparing the Arduino_ST7315 fast paths
+  against the generic per-pixel ArduinoGraphics implementation (called
+  by qualified name, as the shapes are virtual), and
+  the text throughput with and without the glyph cache in characters
+  per second.
+  The last table compares the flash size and draw time of the logo
+  as RGB16, 1bpp and RLE compressed image.
+
+  The bus traffic of typical frames, transfer sizes, addressing modes
+  and transports is measured on the host by extras/test/benchmark.
+*/
+
+#include "Arduino_ST7315.h"
+#include "img_arduinologobw.h"
+#include "img_arduinologobw_1bpp.h"
+#include "img_arduinologobw_rle.h"
+
+#define SCREEN_WIDTH    128   // OLED display width, in pixels
+#define SCREEN_HEIGHT   64    // OLED display height, in pixels
+#define SCREEN_ADDRESS  0x3D  // I2C address for the ST7315
+
+#define ITERATIONS      20    // Repetitions of every test
+
+Arduino_ST7315 Display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire1, SCREEN_ADDRESS);
+
+Image img_arduinologobw(ENCODING_RGB16, (uint8_t *) img_arduinologobw_raw, 60, 60);
+
+void setup() {
+    Serial.begin(115200);
+    while (!Serial) ;
+
+    if (!Display.begin()) {
+        Serial.println("ST7315 Display allocation failed");
+        while (1) ;
+    }
+
+    Serial.println("test            generic(us)   fast(us)   speedup");
+
+    report("clear",      benchClear(false),     benchClear(true));
+    report("lines",      benchLines(false),     benchLines(true));
+    report("h/v lines",  benchHVLines(false),   benchHVLines(true));
+    report("rect",       benchRect(false),      benchRect(true));
+    report("fill rect",  benchFillRect(false),  benchFillRect(true));
+
+    Serial.println();
+    Serial.println("text          generic(ch/s)  fast(ch/s)   speedup");
+
+    Display.background(0, 0, 0);
+    Display.stroke(255, 255, 255);
+    Display.textFont(Font_5x7);
+    reportText("page aligned", benchText(false, 8, 1),  benchText(true, 8, 1));
+    reportText("unaligned",    benchText(false, 3, 1),  benchText(true, 3, 1));
+    reportText("size 2",       benchText(false, 3, 2),  benchText(true, 3, 2));
+    Display.setGlyphCacheSize(32);
+    reportText("cached",       benchText(false, 8, 1),  benchText(true, 8, 1));
+    reportText("cached size 2", benchText(false, 3, 2), benchText(true, 3, 2));
+    Display.setGlyphCacheSize(0);
+    Display.textSize(1);
+
+    Serial.println();
+    Serial.println("image format   flash(bytes)  draw(us)");
+
+    benchImage("RGB16 image()",  sizeof(img_arduinologobw_raw), frameImage);
+    benchImage("1bpp blit()",    sizeof(img_arduinologobw_1bpp), frameBlit);
+    benchImage("RLE blitRLE()",  sizeof(img_arduinologobw_rle),  frameBlitRLE);
+}
+
+void loop() {
+    // Nothing to do here
+}
+
+void report(const char *name, unsigned long generic, unsigned long fast) {
+    char line[64];
+    sprintf(line, "%-14s %12lu %10lu %8.1fx", name, generic, fast, fast ? (float)generic / fast : 0.0f);
+    Serial.println(line);
+}
+
+void reportText(const char *name, unsigned long generic, unsigned long fast) {
+    char line[64];
+    sprintf(line, "%-14s %12lu %11lu %8.1fx", name, generic, fast, generic ? (float)fast / generic : 0.0f);
+    Serial.println(line);
+}
+
+// Characters per second over four text lines 16 rows apart, as many characters
+// as fit the width; the generic path draws each glyph with ArduinoGraphics::bitmap(),
+// one set() call per pixel
+unsigned long benchText(bool fast, int y, uint8_t size) {
+    char str[32];
+    const int chars = min(Display.width() / (Font_5x7.width * size), 31);
+    for (int i = 0; i < chars; i++) {
+        str[i] = 'A' + i;
+    }
+    str[chars] = '\0';
+
+    Display.textSize(size);
+    unsigned long start = micros();
+    for (int n = 0; n < ITERATIONS; n++) {
+        for (int row = 0; row < 4; row++) {
+            const int ty = y + row * 16;
+            if (fast) {
+                Display.text(str, 0, ty);
+                continue;
+            }
+            for (int i = 0; i < chars; i++) {
+                Display.ArduinoGraphics::bitmap(Font_5x7.data[(uint8_t)str[i]], i * Font_5x7.width * size, ty,
+                                                Font_5x7.width, Font_5x7.height, size, size);
+            }
+        }
+    }
+    unsigned long elapsed = micros() - start;
+    return elapsed ? (unsigned long)(ITERATIONS * 4 * chars * 1000000.0 / elapsed) : 0;
+}
+
+unsigned long benchClear(bool fast) {
+    unsigned long start = micros();
+    for (int n = 0; n < ITERATIONS; n++) {
+        Display.background(0, 0, 0);
+        if (fast) Display.clear(); else Display.ArduinoGraphics::clear();
+    }
+    return micros() - start;
+}
+
+unsigned long benchLines(bool fast) {
+    Display.stroke(255, 255, 255);
+    unsigned long start = micros();
+    for (int n = 0; n < ITERATIONS; n++) {
+        for (int i = 0; i < Display.width(); i += 4) {
+            if (fast) Display.line(0, 0, i, Display.height() - 1);
+            else Display.ArduinoGraphics::line(0, 0, i, Display.height() - 1);
+        }
+        for (int i = 0; i < Display.height(); i += 4) {
+            if (fast) Display.line(0, 0, Display.width() - 1, i);
+            else Display.ArduinoGraphics::line(0, 0, Display.width() - 1, i);
+        }
+    }
+    return micros() - start;
+}
+
+unsigned long benchHVLines(bool fast) {
+    Display.stroke(255, 255, 255);
+    unsigned long start = micros();
+    for (int n = 0; n < ITERATIONS; n++) {
+        for (int i = 0; i < Display.width(); i += 4) {
+            if (fast) Display.line(i, 0, i, Display.height() - 1);
+            else Display.ArduinoGraphics::line(i, 0, i, Display.height() - 1);
+        }
+        for (int i = 0; i < Display.height(); i += 4) {
+            if (fast) Display.line(0, i, Display.width() - 1, i);
+            else Display.ArduinoGraphics::line(0, i, Display.width() - 1, i);
+        }
+    }
+    return micros() - start;
+}
+
+unsigned long benchRect(bool fast) {
+    Display.stroke(255, 255, 255);
+    Display.noFill();
+    unsigned long start = micros();
+    for (int n = 0; n < ITERATIONS; n++) {
+        for (int i = 0; i < Display.height() / 2; i += 2) {
+            if (fast) Display.rect(i, i, Display.width() - 2 * i, Display.height() - 2 * i);
+            else Display.ArduinoGraphics::rect(i, i, Display.width() - 2 * i, Display.height() - 2 * i);
+        }
+    }
+    return micros() - start;
+}
+
+unsigned long benchFillRect(bool fast) {
+    Display.noStroke();
+    unsigned long start = micros();
+    for (int n = 0; n < ITERATIONS; n++) {
+        for (int i = 0; i < Display.height() / 2; i += 3) {
+            if (i % 2 == 0) Display.fill(255, 255, 255);
+            else Display.fill(0, 0, 0);
+            if (fast) Display.rect(i, i, Display.width() - i * 2, Display.height() - i * 2);
+            else Display.ArduinoGraphics::rect(i, i, Display.width() - i * 2, Display.height() - i * 2);
+        }
+    }
+    return micros() - start;
+}
+
+void frameImage(Arduino_ST7315 &screen) {
+    screen.clear();
+    screen.image(img_arduinologobw, (screen.width() - img_arduinologobw.width()) / 2, (screen.height() - img_arduinologobw.height()) / 2);
+}
+
+void frameBlit(Arduino_ST7315 &screen) {
+    screen.clear();
+    screen.blit(img_arduinologobw_1bpp, (screen.width() - img_arduinologobw_1bpp_width) / 2, (screen.height() - img_arduinologobw_1bpp_height) / 2,
+                img_arduinologobw_1bpp_width, img_arduinologobw_1bpp_height);
+}
+
+void frameBlitRLE(Arduino_ST7315 &screen) {
+    screen.clear();
+    screen.blitRLE(img_arduinologobw_rle, (screen.width() - img_arduinologobw_rle_width) / 2, (screen.height() - img_arduinologobw_rle_height) / 2);
+}
+
+// Average time to clear the framebuffer and draw the logo, nothing is flushed
+void benchImage(const char *name, size_t flashBytes, void (*draw)(Arduino_ST7315 &)) {
+    unsigned long start = micros();
+    for (int n = 0; n < ITERATIONS; n++) {
+        draw(Display);
+    }
+    const unsigned long elapsed = (micros() - start) / ITERATIONS;
+
+    char line[64];
+    sprintf(line, "%-14s %12u %9lu", name, (unsigned)flashBytes, elapsed);
+    Serial.println(line);
+}
@@ -0,0 +1,34 @@
+/**
+ * @file img_arduinologobw_rle.h
+ * @brief 60x60 RLE compressed 1bpp image for Arduino_ST7315_Driver::blitRLE()
+ *
+ * Generated by extras/tools/st7315_imgconv.py from img_arduinologobw.h
+ *
+ * @note Page-major bitmap of 480 bytes, run-length encoded
+ * @note Array size: 179 bytes
+ */
+
+#ifndef _IMG_ARDUINOLOGOBW_RLE_H
+#define _IMG_ARDUINOLOGOBW_RLE_H
+
+#include <stdint.h>
+
+#define img_arduinologobw_rle_width  60
+#define img_arduinologobw_rle_height 60
+
+const uint8_t img_arduinologobw_rle[] = {
+  0x3c, 0x3c, 0xfb, 0xff, 0x06, 0x7f, 0x3f, 0x1f, 0x0f, 0x07, 0x07, 0x83, 0x82, 0xc3, 0x00, 0xe3,
+  0x81, 0xc3, 0x07, 0x83, 0x87, 0x07, 0x0f, 0x0f, 0x1f, 0x3f, 0x7f, 0x82, 0xff, 0x06, 0x7f, 0x3f,
+  0x1f, 0x0f, 0x07, 0x07, 0x87, 0x87, 0xc3, 0x06, 0x83, 0x07, 0x07, 0x0f, 0x1f, 0x3f, 0x7f, 0x86,
+  0xff, 0x00, 0x07, 0x81, 0x00, 0x01, 0xf0, 0xfc, 0x82, 0xff, 0x85, 0x9f, 0x81, 0xff, 0x0d, 0xfe,
+  0xfc, 0xf8, 0xf0, 0x40, 0x00, 0x01, 0x01, 0x00, 0x60, 0xf0, 0xf8, 0xfe, 0xfe, 0x81, 0xff, 0x80,
+  0x9f, 0x04, 0x07, 0x03, 0x1f, 0x9f, 0x9f, 0x81, 0xff, 0x06, 0xfe, 0xfc, 0xf0, 0x00, 0x00, 0x01,
+  0x0f, 0x84, 0xff, 0x0a, 0xfe, 0xf0, 0xe0, 0x80, 0x01, 0x07, 0x0f, 0x1f, 0x1f, 0x3f, 0x3f, 0x83,
+  0x7f, 0x80, 0x3f, 0x80, 0x1f, 0x20, 0x0f, 0x07, 0x83, 0xc0, 0xe0, 0xf0, 0xf8, 0xf8, 0xf0, 0xc0,
+  0x80, 0x83, 0x07, 0x0f, 0x1f, 0x1f, 0x3f, 0x3f, 0x7f, 0x7c, 0x7c, 0x7f, 0x7f, 0x3f, 0x3f, 0x1f,
+  0x1f, 0x0f, 0x07, 0x00, 0x80, 0xe0, 0xf0, 0x8b, 0xff, 0x00, 0xfe, 0x82, 0xfc, 0x83, 0xf8, 0x81,
+  0xfc, 0x80, 0xfe, 0x8a, 0xff, 0x80, 0xfe, 0x81, 0xfc, 0x83, 0xf8, 0x81, 0xfc, 0x80, 0xfe, 0xc3,
+  0xff, 0xba, 0x0f,
+};
+
+#endif // _IMG_ARDUINOLOGOBW_RLE_H
@@ -0,0 +1,41 @@
+/*
+  SPI Draw Example for ST7315 OLED Display
+
+  This example demonstrates how to drive an ST7315 panel
+  wired for 4-wire SPI, through the Arduino_ST7315_SPIBus
+  transport. Drawing works exactly as over I2C.
+*/
+
+#include "Arduino_ST7315.h"
+
+#define SCREEN_WIDTH    128     // OLED display width, in pixels
+#define SCREEN_HEIGHT   64      // OLED display height, in pixels
+#define SCREEN_CS       10      // Chip select pin
+#define SCREEN_DC       9       // Data/command pin
+#define SCREEN_RST      8       // Reset pin, -1 if not wired
+
+Arduino_ST7315_SPIBus Bus(&SPI, SCREEN_CS, SCREEN_DC, SCREEN_RST);
+Arduino_ST7315 Display(SCREEN_WIDTH, SCREEN_HEIGHT, &Bus);
+
+void setup() {
+    Serial.begin(115200);
+
+    if (!Display.begin()) {
+        Serial.println("ST7315 Display allocation failed");
+        while (1) ;
+    }
+
+    Display.beginDraw();
+    Display.background(0, 0, 0);
+    Display.stroke(255, 255, 255);
+    Display.textFont(Font_5x7);
+
+    Display.text("Hello SPI!", 10, 10);
+    Display.circle(64, 40, 15);
+
+    Display.endDraw();
+}
+
+void loop() {
+    // Nothing to do here
+}
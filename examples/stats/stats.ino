@@ -0,0 +1,78 @@
+/*
+  Stats Example for ST7315 OLED Display
+
+  This example demonstrates the runtime statistics of the
+  Arduino_ST7315 library: frames, bytes and transactions sent,
+  I2C errors, flush time and pixels drawn per frame, plus a
+  trace hook timing the rendering of each frame.
+
+  Statistics and the trace hook are compiled out by default:
+  set ST7315_STATS to 1 in Arduino_ST7315_Config.h of the library
+  (or in the board build flags), not with a #define in the sketch.
+*/
+
+#include "Arduino_ST7315.h"
+
+#define SCREEN_WIDTH    128     // OLED display width, in pixels
+#define SCREEN_HEIGHT   64      // OLED display height, in pixels
+#define SCREEN_ADDRESS  0x3D    // I2C address for the ST7315
+
+Arduino_ST7315 Display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire1, SCREEN_ADDRESS);
+
+unsigned long renderStart = 0;
+unsigned long renderMicros = 0;
+unsigned long lastReport = 0;
+
+void traceHook(Arduino_ST7315_Event event) {
+    if (event == ST7315_EVENT_RENDER_BEGIN) {
+        renderStart = micros();
+    } else if (event == ST7315_EVENT_RENDER_END) {
+        renderMicros = micros() - renderStart;
+    }
+}
+
+void setup() {
+    Serial.begin(115200);
+
+    if (!Display.begin()) {
+        Serial.println("ST7315 Display allocation failed");
+        while (1) ;
+    }
+
+    Display.setTraceHook(traceHook);
+#if !ST7315_STATS
+    Serial.println("Statistics disabled, set ST7315_STATS in Arduino_ST7315_Config.h");
+#endif
+
+    Display.textFont(Font_5x7);
+    Display.stroke(255, 255, 255);
+    Display.background(0, 0, 0);
+}
+
+void loop() {
+    char str[32];
+    sprintf(str, "t = %lu ms", millis());
+
+    Display.beginDraw();
+    Display.text(str, 0, 0);
+    Display.endDraw();
+
+#if ST7315_STATS
+    if (millis() - lastReport >= 1000) {
+        const Arduino_ST7315_Stats &stats = Display.stats();
+        lastReport = millis();
+
+        Serial.print("frames: ");         Serial.print(stats.frames);
+        Serial.print(" bytes: ");         Serial.print(stats.bytes);
+        Serial.print(" transactions: ");  Serial.print(stats.transactions);
+        Serial.print(" NACKs: ");         Serial.print(stats.errors[2] + stats.errors[3]);
+        Serial.print(" timeouts: ");      Serial.print(stats.errors[5]);
+        Serial.print(" flush avg/max (us): ");
+        Serial.print(stats.updateMicrosAverage());
+        Serial.print("/");
+        Serial.print(stats.updateMicrosMax);
+        Serial.print(" render (us): ");   Serial.print(renderMicros);
+        Serial.print(" pixels/frame: ");  Serial.println(stats.framePixels);
+    }
+#endif
+}
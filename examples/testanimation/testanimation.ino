@@ -3,6 +3,10 @@
 
   This example demonstrates a simple animation of a bouncing ball
   on an ST7315 OLED display using the Arduino_ST7315 library.
+
+  The ball is a sprite: every frame only erases it at its old position
+  and draws it at the new one, so endDraw() sends a few columns of two
+  pages instead of the whole frame.
   
   by Leonardo Cavagnis
 */
@@ -15,6 +19,19 @@
 
 Arduino_ST7315 Display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire1, SCREEN_ADDRESS);
 
+// 9x9 ball, one row per two bytes, MSB on the left
+const uint8_t ballBitmap[] = {
+    0b00111110, 0b00000000,
+    0b01111111, 0b00000000,
+    0b11111111, 0b10000000,
+    0b11111111, 0b10000000,
+    0b11111111, 0b10000000,
+    0b11111111, 0b10000000,
+    0b11111111, 0b10000000,
+    0b01111111, 0b00000000,
+    0b00111110, 0b00000000,
+};
+
 const int radius = 4;
 const int frameDelay = 20;
 
@@ -24,6 +41,8 @@ int vy = 2;
 int x = SCREEN_WIDTH  / 2;
 int y = SCREEN_HEIGHT / 2;
 
+int ball;
+
 void setup() {
     Serial.begin(115200);
     
@@ -31,6 +50,13 @@ void setup() {
         Serial.println("ST7315 Display allocation failed");
         while (1) ;
     }
+
+    // XOR sprites need no extra RAM
+    ball = Display.addSprite(ballBitmap, 2 * radius + 1, 2 * radius + 1, ST7315_SPRITE_XOR, ST7315_BITMAP_ROWS);
+    if (ball < 0) {
+        Serial.println("Sprite allocation failed");
+        while (1) ;
+    }
 }
 
 void loop() {
@@ -45,13 +71,8 @@ void loop() {
     }
 
     Display.beginDraw();
-    Display.clear();
-
-    Display.noStroke();
-    Display.fill(255, 255, 255); 
-    Display.circle(x, y, radius * 2);
-
+    Display.moveSprite(ball, x - radius, y - radius);
     Display.endDraw();
 
     delay(frameDelay);
-}
\ No newline at end of file
+}
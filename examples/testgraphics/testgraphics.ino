@@ -9,6 +9,7 @@
 
 #include "Arduino_ST7315.h"
 #include "img_arduinologobw.h"
+#include "img_arduinologobw_1bpp.h"
 
 #define SCREEN_WIDTH    128   // OLED display width, in pixels
 #define SCREEN_HEIGHT   64    // OLED display height, in pixels
@@ -43,6 +44,8 @@ void setup() {
     testScrollText();   // Demonstrate scrolling text
 
     testDrawImage();    // Draw image from memory 
+
+    testDrawBitmap();   // Draw 1bpp bitmap from memory
 }
 
 void loop() {
@@ -331,4 +334,23 @@ void testDrawImage() {
     Display.image(img_arduinologobw, (Display.width() - img_arduinologobw.width())/2, (Display.height() - img_arduinologobw.height())/2);
     Display.endDraw();
     delay(2000);
+}
+
+void testDrawBitmap() {
+    int x = (Display.width() - img_arduinologobw_1bpp_width)/2;
+    int y = (Display.height() - img_arduinologobw_1bpp_height)/2;
+
+    // Same logo as testDrawImage(), 16x smaller in flash and copied byte by byte
+    Display.beginDraw();
+    Display.background(255, 255, 255); // White background
+    Display.clear();
+    Display.blit(img_arduinologobw_1bpp, x, y, img_arduinologobw_1bpp_width, img_arduinologobw_1bpp_height);
+    Display.endDraw();
+    delay(2000);
+
+    // Redraw the logo inverted with a raster operation
+    Display.beginDraw();
+    Display.blit(img_arduinologobw_1bpp, x, y, img_arduinologobw_1bpp_width, img_arduinologobw_1bpp_height, ST7315_BITMAP_PAGES, ST7315_OP_NOT);
+    Display.endDraw();
+    delay(2000);
 }
\ No newline at end of file
@@ -0,0 +1,214 @@
+/*
+  Copyright (c) 2026 Arduino SA
+  This Source Code Form is subject to the terms of the Mozilla
+  Public License (MPL), v 2.0. You can obtain a copy of the MPL
+  at http://mozilla.org/MPL/2.0/
+*/
+
+#include "BusMonitor.h"
+
+// I2C framing, in bit times
+#define I2C_BITS_START_ADDR_STOP   11  // START + 8-bit address + ACK + STOP
+#define I2C_BITS_PER_BYTE          9   // 8 data bits + ACK
+
+BusMonitor::BusMonitor(int width, int height)
+    : _width(width)
+    , _height(height)
+    , _gddram((width * height) / 8, 0xAA)   // Undefined at power up: whatever the driver never writes shows
+    , _transactions(0)
+    , _bytes(0)
+    , _repeatedStarts(0)
+    , _expectControl(true)
+    , _stream(false)
+    , _dataMode(false)
+    , _cmdLen(0)
+    , _cmdNeed(0)
+    , _col(0)
+    , _colStart(0)
+    , _colEnd(width - 1)
+    , _page(0)
+    , _pageStart(0)
+    , _pageEnd(height / 8 - 1)
+    , _startLine(0)
+    , _segRemap(false)
+    , _comScanDec(false)
+{
+}
+
+void BusMonitor::feed(TwoWire &wire)
+{
+    for (const TwoWire::Transaction &t : wire.log) {
+        if (t.bytes.empty()) {
+            continue;
+        }
+        beginTransmission(t.bytes[0], true);
+        write(t.bytes.data() + 1, t.bytes.size() - 1);
+        endTransmission(t.stop);
+    }
+    wire.log.clear();
+}
+
+void BusMonitor::feed(SPIClass &spi)
+{
+    for (const SPIClass::Burst &b : spi.log) {
+        beginTransmission(b.data ? 0x40 : 0x00, false);
+        write(b.bytes.data(), b.bytes.size());
+        endTransmission(true);
+    }
+    spi.log.clear();
+}
+
+void BusMonitor::reset()
+{
+    _transactions = 0;
+    _bytes        = 0;
+    _repeatedStarts = 0;
+}
+
+void BusMonitor::beginTransmission(uint8_t mode, bool controlByte)
+{
+    _expectControl = true;
+    _stream        = false;
+
+    write(&mode, 1);
+    if (!controlByte) {
+        _bytes--;
+    }
+}
+
+void BusMonitor::write(const uint8_t *data, size_t n)
+{
+    _bytes += n;
+
+    for (size_t i = 0; i < n; i++) {
+        const uint8_t b = data[i];
+
+        // Control byte: Co (bit 7) = 0 means only data bytes follow, D/C (bit 6) selects GDDRAM data
+        if (_expectControl) {
+            _stream        = !(b & 0x80);
+            _dataMode      = (b & 0x40) != 0;
+            _expectControl = false;
+            continue;
+        }
+
+        if (_dataMode) {
+            this->data(b);
+        } else {
+            command(b);
+        }
+
+        if (!_stream) {
+            _expectControl = true;
+        }
+    }
+}
+
+void BusMonitor::endTransmission(bool stop)
+{
+    _transactions++;
+    if (!stop) {
+        _repeatedStarts++;
+    }
+}
+
+uint32_t BusMonitor::busMicros(uint32_t clock) const
+{
+    // Minimum bus free time between a STOP and the next START, in ns
+    const uint32_t tBuf = (clock <= 100000) ? 4700 : (clock <= 400000) ? 1300 : 500;
+    const uint64_t bits = (uint64_t)_transactions * I2C_BITS_START_ADDR_STOP + (uint64_t)_bytes * I2C_BITS_PER_BYTE
+                          - _repeatedStarts;
+    const uint64_t stops = _transactions - _repeatedStarts;
+
+    return uint32_t((bits * 1000000ULL) / clock + (stops * tBuf) / 1000);
+}
+
+uint32_t BusMonitor::spiMicros(uint32_t clock) const
+{
+    return uint32_t(((uint64_t)_bytes * 8 * 1000000ULL) / clock);
+}
+
+bool BusMonitor::matches(const uint8_t *framebuffer) const
+{
+    return framebuffer && memcmp(_gddram.data(), framebuffer, _gddram.size()) == 0;
+}
+
+bool BusMonitor::visible(int x, int y) const
+{
+    // Upright as the driver mounts the panel, segment remap and COM scan decrement on;
+    // each COM shows GDDRAM row start line + COM
+    const int col = _segRemap ? x : (_width - 1 - x);
+    const int com = _comScanDec ? y : (_height - 1 - y);
+    const int row = (com + _startLine) % _height;
+    return (_gddram[col + (row / 8) * _width] >> (row & 7)) & 1;
+}
+
+void BusMonitor::command(uint8_t c)
+{
+    _cmd[_cmdLen++] = c;
+
+    if (_cmdLen == 1) {
+        // Number of argument bytes following each command
+        switch (c) {
+        case 0x21: case 0x22: case 0xA3:    // Column / page address, vertical scroll area
+            _cmdNeed = 3;
+            break;
+        case 0x20: case 0x81: case 0x8D: case 0xA8: case 0xD3:
+        case 0xD5: case 0xD9: case 0xDA: case 0xDB:
+            _cmdNeed = 2;
+            break;
+        case 0x26: case 0x27:               // Horizontal scroll setup
+            _cmdNeed = 7;
+            break;
+        case 0x29: case 0x2A:               // Vertical and horizontal scroll setup
+            _cmdNeed = 6;
+            break;
+        default:
+            _cmdNeed = 1;
+            break;
+        }
+    }
+
+    if (_cmdLen < _cmdNeed) {
+        return;
+    }
+
+    switch (_cmd[0]) {
+    case 0x21:
+        _colStart = _cmd[1];
+        _colEnd   = _cmd[2];
+        _col      = _colStart;
+        break;
+    case 0x22:
+        _pageStart = _cmd[1];
+        _pageEnd   = _cmd[2];
+        _page      = _pageStart;
+        break;
+    case 0xA0: case 0xA1:
+        _segRemap = _cmd[0] & 1;
+        break;
+    case 0xC0: case 0xC8:
+        _comScanDec = _cmd[0] & 8;
+        break;
+    default:
+        if ((_cmd[0] & 0xC0) == 0x40) {
+            _startLine = _cmd[0] & 0x3F;
+        }
+        break;
+    }
+    _cmdLen = 0;
+}
+
+void BusMonitor::data(uint8_t d)
+{
+    if (_col < _width && _page < _height / 8) {
+        _gddram[_page * _width + _col] = d;
+    }
+
+    // Horizontal addressing: wrap to the next page of the window, then back to its top
+    if (++_col > _colEnd) {
+        _col = _colStart;
+        if (++_page > _pageEnd) {
+            _page = _pageStart;
+        }
+    }
+}
@@ -0,0 +1,91 @@
+/*
+  Copyright (c) 2026 Arduino SA
+  This Source Code Form is subject to the terms of the Mozilla
+  Public License (MPL), v 2.0. You can obtain a copy of the MPL
+  at http://mozilla.org/MPL/2.0/
+*/
+
+#ifndef _ST7315_TEST_BUSMONITOR_H
+#define _ST7315_TEST_BUSMONITOR_H
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <SPI.h>
+#include <vector>
+
+// @class BusMonitor
+// @brief Replays the traffic logged by the stub TwoWire and SPIClass.
+// The monitor counts transactions and bytes, estimates the time they take on
+// the I2C or SPI bus at a given clock, and decodes them into a model of the
+// controller GDDRAM, so the driver can be measured and checked without a panel.
+
+class BusMonitor
+{
+public:
+    BusMonitor(int width = 128, int height = 64);
+
+    // Replay and clear the log of the stub bus. I2C transactions start with
+    // a control byte, SPI bursts take the mode from the D/C level.
+    void feed(TwoWire &wire);
+    void feed(SPIClass &spi);
+
+    void reset();   // Clears the counters, the GDDRAM model is kept
+
+    uint32_t transactions() const { return _transactions; }
+    uint32_t bytes() const { return _bytes; }                  // Bytes after the address byte, control bytes included
+    uint32_t repeatedStarts() const { return _repeatedStarts; }
+
+    // Estimated bus time for the recorded traffic at the given SCL clock:
+    // START + address + ACK + STOP per transaction, 9 bits per byte, plus the bus free time between transactions.
+    // A repeated START saves the STOP and the bus free time.
+    uint32_t busMicros(uint32_t clock) const;
+    // Same over SPI: 8 clocks per byte, chip select and D/C changes are not counted
+    uint32_t spiMicros(uint32_t clock) const;
+
+    const uint8_t *gddram() const { return _gddram.data(); }
+    bool matches(const uint8_t *framebuffer) const;             // GDDRAM model equals a framebuffer in GDDRAM order
+
+    // Display state set by commands
+    uint8_t startLine() const { return _startLine; }
+    bool segmentRemap() const { return _segRemap; }             // 0xA1
+    bool comScanDecrement() const { return _comScanDec; }       // 0xC8
+
+    // Pixel shown at screen position x, y: start line and scan directions applied
+    bool visible(int x, int y) const;
+
+private:
+    void beginTransmission(uint8_t mode, bool controlByte);
+    void write(const uint8_t *data, size_t n);
+    void endTransmission(bool stop);
+
+    void command(uint8_t c);
+    void data(uint8_t d);
+
+private:
+    int         _width;
+    int         _height;
+    std::vector<uint8_t> _gddram;
+
+    uint32_t    _transactions;
+    uint32_t    _bytes;
+    uint32_t    _repeatedStarts;
+
+    // Control byte decoding
+    bool        _expectControl;     // Next byte is a control byte
+    bool        _stream;            // Co = 0: the rest of the transaction has the same D/C
+    bool        _dataMode;          // D/C = 1
+
+    // Command decoding, commands may span transactions
+    uint8_t     _cmd[8];
+    uint8_t     _cmdLen;
+    uint8_t     _cmdNeed;
+
+    // Address pointers, horizontal addressing mode
+    uint8_t     _col, _colStart, _colEnd;
+    uint8_t     _page, _pageStart, _pageEnd;
+    uint8_t     _startLine;
+    bool        _segRemap;
+    bool        _comScanDec;
+};
+
+#endif // _ST7315_TEST_BUSMONITOR_H
@@ -0,0 +1,251 @@
+/*
+  Copyright (c) 2026 Arduino SA
+  This Source Code Form is subject to the terms of the Mozilla
+  Public License (MPL), v 2.0. You can obtain a copy of the MPL
+  at http://mozilla.org/MPL/2.0/
+*/
+
+// Bus traffic of typical frames: host CPU time to draw and flush them, bytes and
+// transactions on the wire, estimated bus time at 100 kHz, 400 kHz and 1 MHz, and
+// whether the GDDRAM rebuilt from the traffic matches the framebuffer. Then the
+// same for the I2C transfer sizes and addressing modes, and for the I2C and SPI
+// transports. Exits with 1 on any mismatch. The CPU times compare the code paths
+// with each other, they include the logging of the stub bus and are not MCU times.
+
+#include <chrono>
+
+#include "Arduino_ST7315.h"
+#include "BusMonitor.h"
+
+#include "img_arduinologobw.h"
+#include "img_arduinologobw_1bpp.h"
+#include "img_arduinologobw_rle.h"
+
+#define PIN_CS          10
+#define PIN_DC          9
+#define PIN_RST         8
+
+#define WIRE_BUFFER     256     // Room for every transfer size of the table, as on mbed cores
+
+static Image img_arduinologobw(ENCODING_RGB16, (const uint8_t *)img_arduinologobw_raw, 60, 60);
+
+typedef std::chrono::steady_clock Clock;
+
+static double microsSince(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
+
+static bool mismatch = false;
+static int  frameCount = 0;     // Frames benchmarked so far, both transports drawing one
+
+static void frameFull(Arduino_ST7315 &screen)
+{
+    // One pixel wide stripes, shifted by a column at every frame: every byte changes
+    const int phase = frameCount & 1;
+
+    screen.noStroke();
+    for (int x = 0; x < screen.width(); x++) {
+        const uint8_t level = ((x + phase) & 1) ? 255 : 0;
+        screen.fill(level, level, level);
+        screen.rect(x, 0, 1, screen.height());
+    }
+    screen.noFill();
+    screen.stroke(255, 255, 255);
+}
+
+static void framePixel(Arduino_ST7315 &screen)
+{
+    // Flip the pixel in the middle, black first: it is white after frameFull()
+    static bool on = true;
+    on = !on;
+    screen.stroke(on ? 255 : 0, on ? 255 : 0, on ? 255 : 0);
+    screen.point(screen.width() / 2, screen.height() / 2);
+    screen.stroke(255, 255, 255);
+}
+
+static void frameText(Arduino_ST7315 &screen)
+{
+    screen.text("Hello, world!", 0, 0);
+}
+
+static void frameShapes(Arduino_ST7315 &screen)
+{
+    screen.clear();
+    screen.noFill();
+    for (int i = 0; i < screen.height() / 2; i += 2) {
+        screen.rect(i, i, screen.width() - 2 * i, screen.height() - 2 * i);
+    }
+    screen.circle(screen.width() / 2, screen.height() / 2, 20);
+    screen.line(0, 0, screen.width() - 1, screen.height() - 1);
+}
+
+static void frameImage(Arduino_ST7315 &screen)
+{
+    screen.clear();
+    screen.image(img_arduinologobw, (screen.width() - 60) / 2, (screen.height() - 60) / 2);
+}
+
+static void frameBlit(Arduino_ST7315 &screen)
+{
+    screen.clear();
+    screen.blit(img_arduinologobw_1bpp, (screen.width() - img_arduinologobw_1bpp_width) / 2,
+                (screen.height() - img_arduinologobw_1bpp_height) / 2,
+                img_arduinologobw_1bpp_width, img_arduinologobw_1bpp_height);
+}
+
+static void frameBlitRLE(Arduino_ST7315 &screen)
+{
+    screen.clear();
+    screen.blitRLE(img_arduinologobw_rle, (screen.width() - img_arduinologobw_rle_width) / 2,
+                   (screen.height() - img_arduinologobw_rle_height) / 2);
+}
+
+// Draw one frame, flush it and report the recorded traffic
+static void benchFrame(Arduino_ST7315 &display, BusMonitor &monitor, const char *name, void (*draw)(Arduino_ST7315 &))
+{
+    frameCount++;
+    const Clock::time_point start = Clock::now();
+    display.beginDraw();
+    draw(display);
+    const double drawMicros = microsSince(start);
+    const Clock::time_point flushStart = Clock::now();
+    display.endDraw();
+    const double flushMicros = microsSince(flushStart);
+
+    monitor.reset();
+    monitor.feed(Wire1);
+    const bool ok = monitor.matches(display.framebuffer());
+    mismatch |= !ok;
+
+    printf("%-14s %8.1f %9.1f %6lu %4lu %9lu %9lu %7lu  %s\n", name, drawMicros, flushMicros,
+           (unsigned long)monitor.bytes(), (unsigned long)monitor.transactions(),
+           (unsigned long)monitor.busMicros(100000), (unsigned long)monitor.busMicros(400000),
+           (unsigned long)monitor.busMicros(1000000), ok ? "ok" : "MISMATCH");
+}
+
+// Flush a full frame and a few scattered pixels with the given transfer settings
+static void benchTransfer(Arduino_ST7315 &display, BusMonitor &monitor, size_t size,
+                          Arduino_ST7315_Addressing mode, const char *modeName)
+{
+    display.setTransferSize(size);
+    display.setAddressing(mode);
+
+    static bool white = false;
+    for (int frame = 0; frame < 2; frame++) {
+        frameCount++;
+        display.beginDraw();
+        if (frame == 0) {
+            white = !white;
+            display.background(white ? 255 : 0, white ? 255 : 0, white ? 255 : 0);
+            display.clear();
+        } else {
+            display.stroke(white ? 0 : 255, white ? 0 : 255, white ? 0 : 255);
+            for (int i = 0; i < 8; i++) {
+                display.point(i * 16, i * 8);
+            }
+        }
+        const Clock::time_point start = Clock::now();
+        display.endDraw();
+        const double flushMicros = microsSince(start);
+
+        monitor.reset();
+        monitor.feed(Wire1);
+        mismatch |= !monitor.matches(display.framebuffer());
+
+        printf("%8lu %-14s %-6s %9.1f %7lu %4lu %9lu\n", (unsigned long)display.transferSize(), modeName,
+               frame == 0 ? "full" : "pixels", flushMicros, (unsigned long)monitor.bytes(),
+               (unsigned long)monitor.transactions(), (unsigned long)monitor.busMicros(400000));
+    }
+
+    display.background(0, 0, 0);
+    display.stroke(255, 255, 255);
+}
+
+// Draw the same frame over I2C and over SPI
+static void benchTransport(Arduino_ST7315 &i2c, BusMonitor &i2cMonitor, Arduino_ST7315 &spi, BusMonitor &spiMonitor,
+                           const char *name, void (*draw)(Arduino_ST7315 &))
+{
+    frameCount++;
+    i2c.beginDraw();
+    draw(i2c);
+    i2c.endDraw();
+    i2cMonitor.reset();
+    i2cMonitor.feed(Wire);
+
+    spi.beginDraw();
+    draw(spi);
+    spi.endDraw();
+    spiMonitor.reset();
+    spiMonitor.feed(SPI);
+
+    mismatch |= !i2cMonitor.matches(i2c.framebuffer());
+    mismatch |= !spiMonitor.matches(spi.framebuffer());
+    mismatch |= memcmp(i2c.framebuffer(), spi.framebuffer(), 1024) != 0;
+
+    printf("%-14s %9lu %4lu %10lu %8lu | %9lu %7lu %8lu\n", name,
+           (unsigned long)i2cMonitor.bytes(), (unsigned long)i2cMonitor.transactions(),
+           (unsigned long)i2cMonitor.busMicros(400000), (unsigned long)i2cMonitor.busMicros(1000000),
+           (unsigned long)spiMonitor.bytes(), (unsigned long)spiMonitor.transactions(),
+           (unsigned long)spiMonitor.spiMicros(ST7315_SPI_CLOCK));
+}
+
+int main()
+{
+    Wire1.bufferLength = WIRE_BUFFER;
+
+    Arduino_ST7315 display(128, 64, &Wire1, 0x3D);
+    BusMonitor monitor;
+
+    if (!display.begin()) {
+        puts("ST7315 Display allocation failed");
+        return 1;
+    }
+    monitor.feed(Wire1);
+
+    display.background(0, 0, 0);
+    display.stroke(255, 255, 255);
+    display.textFont(Font_5x7);
+
+    puts("frame          draw(us) flush(us)  bytes   tx  bus@100k  bus@400k  bus@1M  gddram");
+    benchFrame(display, monitor, "full frame",   frameFull);
+    benchFrame(display, monitor, "single pixel", framePixel);
+    benchFrame(display, monitor, "text",         frameText);
+    benchFrame(display, monitor, "shapes",       frameShapes);
+    benchFrame(display, monitor, "image()",      frameImage);
+    benchFrame(display, monitor, "blit()",       frameBlit);
+    benchFrame(display, monitor, "blitRLE()",    frameBlitRLE);
+
+    puts("");
+    puts("transfer addressing      frame  flush(us)   bytes   tx  bus@400k");
+    const size_t defaultSize = display.transferSize();
+    benchTransfer(display, monitor, 32,  ST7315_ADDRESSING_SEPARATE,       "separate");
+    benchTransfer(display, monitor, 255, ST7315_ADDRESSING_SEPARATE,       "separate");
+    benchTransfer(display, monitor, 255, ST7315_ADDRESSING_CONTINUATION,   "continuation");
+    benchTransfer(display, monitor, 255, ST7315_ADDRESSING_REPEATED_START, "repeated start");
+    display.setTransferSize(defaultSize);
+    display.setAddressing(ST7315_ADDRESSING_SEPARATE);
+
+    // A fresh pair of displays, both starting from a blank screen
+    Wire.bufferLength = WIRE_BUFFER;
+    SPI.csPin = PIN_CS;
+    SPI.dcPin = PIN_DC;
+    Arduino_ST7315_SPIBus bus(&SPI, PIN_CS, PIN_DC, PIN_RST);
+    Arduino_ST7315 i2cDisplay(128, 64, &Wire, 0x3D), spiDisplay(128, 64, &bus);
+    BusMonitor i2cMonitor, spiMonitor;
+    if (!i2cDisplay.begin() || !spiDisplay.begin()) {
+        puts("ST7315 Display allocation failed");
+        return 1;
+    }
+    i2cMonitor.feed(Wire);
+    spiMonitor.feed(SPI);
+
+    puts("");
+    puts("frame          I2C bytes   tx  @400k(us)  @1M(us) | SPI bytes  bursts  @8M(us)");
+    benchTransport(i2cDisplay, i2cMonitor, spiDisplay, spiMonitor, "full frame", frameFull);
+    benchTransport(i2cDisplay, i2cMonitor, spiDisplay, spiMonitor, "text",       frameText);
+    benchTransport(i2cDisplay, i2cMonitor, spiDisplay, spiMonitor, "shapes",     frameShapes);
+    benchTransport(i2cDisplay, i2cMonitor, spiDisplay, spiMonitor, "blit()",     frameBlit);
+
+    return mismatch ? 1 : 0;
+}
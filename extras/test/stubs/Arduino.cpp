@@ -0,0 +1,99 @@
+/*
+  Copyright (c) 2026 Arduino SA
+  This Source Code Form is subject to the terms of the Mozilla
+  Public License (MPL), v 2.0. You can obtain a copy of the MPL
+  at http://mozilla.org/MPL/2.0/
+*/
+
+#include "Arduino.h"
+#include <chrono>
+
+HardwareSerial Serial;
+
+int      pinLevel[TEST_PINS];
+unsigned pinRises[TEST_PINS];
+
+void pinMode(int pin, int mode)
+{
+    (void)pin;
+    (void)mode;
+}
+
+void digitalWrite(int pin, int level)
+{
+    if (pin < 0 || pin >= TEST_PINS) {
+        return;
+    }
+    if (level && !pinLevel[pin]) {
+        pinRises[pin]++;
+    }
+    pinLevel[pin] = level ? HIGH : LOW;
+}
+
+int analogRead(int pin)
+{
+    (void)pin;
+    return 512;
+}
+
+unsigned long micros()
+{
+    using namespace std::chrono;
+    static const steady_clock::time_point start = steady_clock::now();
+    return (unsigned long)duration_cast<microseconds>(steady_clock::now() - start).count();
+}
+
+unsigned long millis()
+{
+    return micros() / 1000;
+}
+
+// Nothing waits on the host: scroll and reset delays would only slow the tests down
+void delay(unsigned long ms)
+{
+    (void)ms;
+}
+
+void delayMicroseconds(unsigned int us)
+{
+    (void)us;
+}
+
+void yield()
+{
+}
+
+size_t Print::write(const uint8_t *buffer, size_t size)
+{
+    size_t n = 0;
+    while (size--) {
+        n += write(*buffer++);
+    }
+    return n;
+}
+
+size_t Print::print(int n)
+{
+    return print((long)n);
+}
+
+size_t Print::print(long n)
+{
+    char buf[24];
+    snprintf(buf, sizeof(buf), "%ld", n);
+    return print(buf);
+}
+
+size_t Print::print(unsigned long n)
+{
+    char buf[24];
+    snprintf(buf, sizeof(buf), "%lu", n);
+    return print(buf);
+}
+
+size_t Print::print(double n, int digits)
+{
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%.*f", digits, n);
+    return print(buf);
+}
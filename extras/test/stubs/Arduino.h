@@ -0,0 +1,98 @@
+/*
+  Copyright (c) 2026 Arduino SA
+  This Source Code Form is subject to the terms of the Mozilla
+  Public License (MPL), v 2.0. You can obtain a copy of the MPL
+  at http://mozilla.org/MPL/2.0/
+*/
+
+// Host stand-in for the parts of the Arduino core used by the library and the tests
+
+#ifndef _ST7315_TEST_ARDUINO_H
+#define _ST7315_TEST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+
+using std::min;
+using std::max;
+
+#define constrain(amt, low, high)   ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+typedef bool    boolean;
+typedef uint8_t byte;
+
+#define PROGMEM
+#define pgm_read_byte(p)    (*(const uint8_t *)(p))
+
+#define LOW     0
+#define HIGH    1
+#define INPUT   0
+#define OUTPUT  1
+
+#define A0      0
+
+// Pin levels, and the number of rising edges per pin so that SPI chip select
+// pulses can be told apart
+#define TEST_PINS   64
+extern int      pinLevel[TEST_PINS];
+extern unsigned pinRises[TEST_PINS];
+
+void pinMode(int pin, int mode);
+void digitalWrite(int pin, int level);
+int analogRead(int pin);
+
+unsigned long micros();
+unsigned long millis();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+class String : public std::string
+{
+public:
+    using std::string::string;
+    String() {}
+    String(const std::string &s) : std::string(s) {}
+
+    unsigned length() const { return size(); }
+    char charAt(unsigned i) const { return (*this)[i]; }
+};
+
+class Print
+{
+public:
+    virtual ~Print() {}
+
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size);
+
+    size_t print(const char *s) { return write((const uint8_t *)s, strlen(s)); }
+    size_t print(const String &s) { return print(s.c_str()); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(int n);
+    size_t print(unsigned n) { return print((unsigned long)n); }
+    size_t print(long n);
+    size_t print(unsigned long n);
+    size_t print(double n, int digits = 2);
+
+    template <class T>
+    size_t println(T value) { return print(value) + println(); }
+    size_t println() { return print("\n"); }
+};
+
+class HardwareSerial : public Print
+{
+public:
+    void begin(unsigned long baud) { (void)baud; }
+    size_t write(uint8_t c) override { return putchar(c) == EOF ? 0 : 1; }
+    operator bool() const { return true; }
+};
+
+extern HardwareSerial Serial;
+
+#endif // _ST7315_TEST_ARDUINO_H
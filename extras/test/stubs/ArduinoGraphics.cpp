@@ -0,0 +1,325 @@
+/*
+  Copyright (c) 2026 Arduino SA
+  This Source Code Form is subject to the terms of the Mozilla
+  Public License (MPL), v 2.0. You can obtain a copy of the MPL
+  at http://mozilla.org/MPL/2.0/
+*/
+
+#include "ArduinoGraphics.h"
+#include <math.h>
+
+static uint8_t glyphs4x6[256][6];
+static uint8_t glyphs5x7[256][7];
+
+template <int W, int H>
+static Font makeFont(uint8_t (&glyphs)[256][H])
+{
+    Font font;
+    font.width  = W;
+    font.height = H;
+    for (int c = 0; c < 256; c++) {
+        for (int row = 0; row < H; row++) {
+            glyphs[c][row] = uint8_t((c * 37 + row * 91 + (c >> 3) * 13) & (0xFF << (8 - W)));
+        }
+        font.data[c] = glyphs[c];
+    }
+    return font;
+}
+
+const Font Font_4x6 = makeFont<4, 6>(glyphs4x6);
+const Font Font_5x7 = makeFont<5, 7>(glyphs5x7);
+
+ArduinoGraphics::ArduinoGraphics(int width, int height)
+    : _width(width)
+    , _height(height)
+{
+}
+
+void ArduinoGraphics::background(uint8_t r, uint8_t g, uint8_t b)
+{
+    _backgroundR = r;
+    _backgroundG = g;
+    _backgroundB = b;
+}
+
+void ArduinoGraphics::background(uint32_t color)
+{
+    background(color >> 16, color >> 8, color);
+}
+
+void ArduinoGraphics::clear()
+{
+    for (int x = 0; x < _width; x++) {
+        for (int y = 0; y < _height; y++) {
+            set(x, y, _backgroundR, _backgroundG, _backgroundB);
+        }
+    }
+}
+
+void ArduinoGraphics::fill(uint8_t r, uint8_t g, uint8_t b)
+{
+    _fill  = true;
+    _fillR = r;
+    _fillG = g;
+    _fillB = b;
+}
+
+void ArduinoGraphics::fill(uint32_t color)
+{
+    fill(color >> 16, color >> 8, color);
+}
+
+void ArduinoGraphics::noFill()
+{
+    _fill = false;
+}
+
+void ArduinoGraphics::stroke(uint8_t r, uint8_t g, uint8_t b)
+{
+    _stroke  = true;
+    _strokeR = r;
+    _strokeG = g;
+    _strokeB = b;
+}
+
+void ArduinoGraphics::stroke(uint32_t color)
+{
+    stroke(color >> 16, color >> 8, color);
+}
+
+void ArduinoGraphics::noStroke()
+{
+    _stroke = false;
+}
+
+void ArduinoGraphics::circle(int x, int y, int diameter)
+{
+    ellipse(x, y, diameter, diameter);
+}
+
+void ArduinoGraphics::ellipse(int x, int y, int width, int height)
+{
+    const long a = width / 2;
+    const long b = height / 2;
+
+    if (_fill && a && b) {
+        for (long j = -b; j <= b; j++) {
+            for (long i = -a; i <= a; i++) {
+                if (i * i * b * b + j * j * a * a <= a * a * b * b) {
+                    set(x + i, y + j, _fillR, _fillG, _fillB);
+                }
+            }
+        }
+    }
+    if (_stroke) {
+        for (int t = 0; t < 360; t++) {
+            const double r = t * M_PI / 180;
+            set(x + (int)lround(a * cos(r)), y + (int)lround(b * sin(r)), _strokeR, _strokeG, _strokeB);
+        }
+    }
+}
+
+void ArduinoGraphics::line(int x1, int y1, int x2, int y2)
+{
+    if (!_stroke) {
+        return;
+    }
+
+    // Bresenham, both end points included
+    const int dx = abs(x2 - x1), sx = (x1 < x2) ? 1 : -1;
+    const int dy = -abs(y2 - y1), sy = (y1 < y2) ? 1 : -1;
+    int err = dx + dy;
+    while (true) {
+        set(x1, y1, _strokeR, _strokeG, _strokeB);
+        if (x1 == x2 && y1 == y2) {
+            break;
+        }
+        const int e2 = 2 * err;
+        if (e2 >= dy) {
+            err += dy;
+            x1  += sx;
+        }
+        if (e2 <= dx) {
+            err += dx;
+            y1  += sy;
+        }
+    }
+}
+
+void ArduinoGraphics::point(int x, int y)
+{
+    if (_stroke) {
+        set(x, y, _strokeR, _strokeG, _strokeB);
+    }
+}
+
+void ArduinoGraphics::rect(int x, int y, int width, int height)
+{
+    const int x1 = x + width - 1;
+    const int y1 = y + height - 1;
+
+    for (int j = y; j <= y1; j++) {
+        for (int i = x; i <= x1; i++) {
+            if (_stroke && (i == x || i == x1 || j == y || j == y1)) {
+                set(i, j, _strokeR, _strokeG, _strokeB);
+            } else if (_fill) {
+                set(i, j, _fillR, _fillG, _fillB);
+            }
+        }
+    }
+}
+
+void ArduinoGraphics::text(const char *str, int x, int y)
+{
+    if (!_font || !_stroke) {
+        return;
+    }
+
+    while (*str) {
+        const uint8_t c = (uint8_t)*str++;
+
+        if (c == '\n') {
+            y += _font->height * _textSizeY;
+        } else if (c == '\r') {
+            x = 0;
+        } else if (c == 0xc2 || c == 0xc3) {
+            // UTF-8 lead bytes are dropped
+        } else {
+            const uint8_t *b = _font->data[c] ? _font->data[c] : _font->data[0x20];
+            if (b) {
+                bitmap(b, x, y, _font->width, _font->height, _textSizeX, _textSizeY);
+            }
+            x += _font->width * _textSizeX;
+        }
+    }
+}
+
+void ArduinoGraphics::textFont(const Font &which)
+{
+    _font = &which;
+}
+
+void ArduinoGraphics::textSize(uint8_t sx, uint8_t sy)
+{
+    _textSizeX = sx ? sx : 1;
+    _textSizeY = sy ? sy : 1;
+}
+
+int ArduinoGraphics::textFontWidth() const
+{
+    return _font ? _font->width * _textSizeX : 0;
+}
+
+int ArduinoGraphics::textFontHeight() const
+{
+    return _font ? _font->height * _textSizeY : 0;
+}
+
+void ArduinoGraphics::bitmap(const uint8_t *data, int x, int y, int width, int height, uint8_t scale_x, uint8_t scale_y)
+{
+    if (!_stroke || !scale_x || !scale_y) {
+        return;
+    }
+    if (!data || (x + width * scale_x) < 0 || (y + height * scale_y) < 0 || x > _width || y > _height) {
+        return;
+    }
+
+    // One byte per row: set bits get the stroke color, clear bits the background.
+    // Columns past the byte (a shift by a negative count upstream) stay clear.
+    for (int j = 0; j < height; j++) {
+        const uint8_t b = data[j];
+        for (int ys = 0; ys < scale_y; ys++) {
+            for (int i = 0; i < width; i++) {
+                for (int xs = 0; xs < scale_x; xs++) {
+                    if (i < 8 && (b & (1 << (7 - i)))) {
+                        set(x + i * scale_x + xs, y + j * scale_y + ys, _strokeR, _strokeG, _strokeB);
+                    } else {
+                        set(x + i * scale_x + xs, y + j * scale_y + ys, _backgroundR, _backgroundG, _backgroundB);
+                    }
+                }
+            }
+        }
+    }
+}
+
+void ArduinoGraphics::image(const Image &img, int x, int y)
+{
+    if (img.encoding() != ENCODING_RGB16) {
+        return;
+    }
+
+    const uint16_t *p = (const uint16_t *)img.data();
+    for (int j = 0; j < img.height(); j++) {
+        for (int i = 0; i < img.width(); i++) {
+            const uint16_t c = *p++;
+            set(x + i, y + j, ((c >> 11) & 0x1f) << 3, ((c >> 5) & 0x3f) << 2, (c & 0x1f) << 3);
+        }
+    }
+}
+
+void ArduinoGraphics::beginText(int x, int y)
+{
+    _textBuffer = "";
+    _textX      = x;
+    _textY      = y;
+}
+
+void ArduinoGraphics::beginText(int x, int y, uint8_t r, uint8_t g, uint8_t b)
+{
+    beginText(x, y);
+    _textR = r;
+    _textG = g;
+    _textB = b;
+}
+
+void ArduinoGraphics::beginText(int x, int y, uint32_t color)
+{
+    beginText(x, y, color >> 16, color >> 8, color);
+}
+
+void ArduinoGraphics::endText(int scroll)
+{
+    // As the real library: the text is drawn with the stroke set to the text color,
+    // through the non-virtual stroke(), then the stroke is restored
+    const bool    strokeOn = _stroke;
+    const uint8_t strokeR  = _strokeR;
+    const uint8_t strokeG  = _strokeG;
+    const uint8_t strokeB  = _strokeB;
+
+    stroke(_textR, _textG, _textB);
+
+    if (scroll == SCROLL_LEFT) {
+        const int steps = _textBuffer.length() * textFontWidth() + _textX;
+        for (int i = 0; i < steps; i++) {
+            beginDraw();
+            text(_textBuffer, _textX - i, _textY);
+            endDraw();
+            delay(_textScrollSpeed);
+        }
+    } else if (scroll == SCROLL_UP) {
+        const int steps = textFontHeight() + _textY;
+        for (int i = 0; i < steps; i++) {
+            beginDraw();
+            text(_textBuffer, _textX, _textY - i);
+            endDraw();
+            delay(_textScrollSpeed);
+        }
+    } else {
+        beginDraw();
+        text(_textBuffer, _textX, _textY);
+        endDraw();
+    }
+
+    if (strokeOn) {
+        stroke(strokeR, strokeG, strokeB);
+    } else {
+        noStroke();
+    }
+    _textBuffer = "";
+}
+
+size_t ArduinoGraphics::write(uint8_t b)
+{
+    _textBuffer += (char)b;
+    return 1;
+}
@@ -0,0 +1,127 @@
+/*
+  Copyright (c) 2026 Arduino SA
+  This Source Code Form is subject to the terms of the Mozilla
+  Public License (MPL), v 2.0. You can obtain a copy of the MPL
+  at http://mozilla.org/MPL/2.0/
+*/
+
+// Host stand-in for the ArduinoGraphics library: same API and drawing rules for
+// the parts used by Arduino_ST7315, generic per-pixel implementations throughout
+
+#ifndef _ST7315_TEST_ARDUINOGRAPHICS_H
+#define _ST7315_TEST_ARDUINOGRAPHICS_H
+
+#include <Arduino.h>
+
+#define NO_SCROLL       0
+#define SCROLL_LEFT     1
+#define SCROLL_RIGHT    2
+#define SCROLL_UP       3
+#define SCROLL_DOWN     4
+
+#define ENCODING_NONE   -1
+#define ENCODING_RGB    0
+#define ENCODING_RGB24  1
+#define ENCODING_RGB16  2
+
+// Glyph rows, MSB first
+struct Font {
+    int             width;
+    int             height;
+    const uint8_t   *data[256];
+};
+
+// Made-up glyphs with the geometry of the real fonts
+extern const Font Font_4x6;
+extern const Font Font_5x7;
+
+class Image
+{
+public:
+    Image(int encoding, const uint8_t *data, int width, int height)
+        : _encoding(encoding), _data(data), _width(width), _height(height) {}
+
+    int encoding() const { return _encoding; }
+    const uint8_t *data() const { return _data; }
+    int width() const { return _width; }
+    int height() const { return _height; }
+
+private:
+    int             _encoding;
+    const uint8_t   *_data;
+    int             _width;
+    int             _height;
+};
+
+class ArduinoGraphics : public Print
+{
+public:
+    ArduinoGraphics(int width, int height);
+    virtual ~ArduinoGraphics() {}
+
+    virtual int begin() { return 1; }
+    virtual void end() {}
+
+    int width() { return _width; }
+    int height() { return _height; }
+
+    virtual void beginDraw() {}
+    virtual void endDraw() {}
+
+    void background(uint8_t r, uint8_t g, uint8_t b);
+    void background(uint32_t color);
+    void clear();
+    void fill(uint8_t r, uint8_t g, uint8_t b);
+    void fill(uint32_t color);
+    void noFill();
+    void stroke(uint8_t r, uint8_t g, uint8_t b);
+    void stroke(uint32_t color);
+    void noStroke();
+
+    // As upstream: the color setters above are not virtual, the shapes are
+    virtual void circle(int x, int y, int diameter);
+    virtual void ellipse(int x, int y, int width, int height);
+    virtual void line(int x1, int y1, int x2, int y2);
+    virtual void point(int x, int y);
+    virtual void rect(int x, int y, int width, int height);
+
+    virtual void text(const char *str, int x = 0, int y = 0);
+    virtual void text(const String &str, int x = 0, int y = 0) { text(str.c_str(), x, y); }
+    virtual void textFont(const Font &which);
+    virtual void textSize(uint8_t s) { textSize(s, s); }
+    virtual void textSize(uint8_t sx, uint8_t sy);
+    virtual int textFontWidth() const;
+    virtual int textFontHeight() const;
+
+    virtual void bitmap(const uint8_t *data, int x, int y, int width, int height, uint8_t scale_x = 1, uint8_t scale_y = 1);
+    virtual void image(const Image &img, int x = 0, int y = 0);
+
+    virtual void set(int x, int y, uint8_t r, uint8_t g, uint8_t b) = 0;
+
+    virtual void beginText(int x = 0, int y = 0);
+    virtual void beginText(int x, int y, uint8_t r, uint8_t g, uint8_t b);
+    virtual void beginText(int x, int y, uint32_t color);
+    virtual void endText(int scroll = NO_SCROLL);
+    virtual void textScrollSpeed(unsigned long speed = 150) { _textScrollSpeed = speed; }
+
+    size_t write(uint8_t b) override;
+
+private:
+    int             _width;
+    int             _height;
+
+    bool            _stroke = true;
+    uint8_t         _strokeR = 255, _strokeG = 255, _strokeB = 255;
+    bool            _fill = true;
+    uint8_t         _fillR = 255, _fillG = 255, _fillB = 255;
+    uint8_t         _backgroundR = 0, _backgroundG = 0, _backgroundB = 0;
+
+    const Font      *_font = &Font_5x7;
+    uint8_t         _textSizeX = 1, _textSizeY = 1;
+    int             _textX = 0, _textY = 0;
+    uint8_t         _textR = 255, _textG = 255, _textB = 255;
+    String          _textBuffer;
+    unsigned long   _textScrollSpeed = 150;
+};
+
+#endif // _ST7315_TEST_ARDUINOGRAPHICS_H
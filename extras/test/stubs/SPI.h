@@ -0,0 +1,96 @@
+/*
+  Copyright (c) 2026 Arduino SA
+  This Source Code Form is subject to the terms of the Mozilla
+  Public License (MPL), v 2.0. You can obtain a copy of the MPL
+  at http://mozilla.org/MPL/2.0/
+*/
+
+// Host stand-in for SPIClass: bytes are logged with the D/C level, in bursts
+// split at every chip select pulse and D/C change
+
+#ifndef _ST7315_TEST_SPI_H
+#define _ST7315_TEST_SPI_H
+
+#include <Arduino.h>
+#include <vector>
+
+#define MSBFIRST    1
+#define SPI_MODE0   0
+
+struct SPISettings {
+    SPISettings(uint32_t clock = 4000000, uint8_t bitOrder = MSBFIRST, uint8_t dataMode = SPI_MODE0)
+        : clock(clock) { (void)bitOrder; (void)dataMode; }
+    uint32_t clock;
+};
+
+class SPIClass
+{
+public:
+    struct Burst {
+        bool                    data;       // D/C level
+        std::vector<uint8_t>    bytes;
+    };
+
+    std::vector<Burst> log;
+    int         csPin = -1;
+    int         dcPin = -1;
+    int         transactions = 0;       // beginTransaction() calls
+    int         open = 0;               // Transactions not ended yet
+    bool        misuse = false;         // Nested transaction, or a byte outside a transaction or chip select
+
+    void begin() {}
+    void end() {}
+
+    void beginTransaction(SPISettings settings)
+    {
+        (void)settings;
+        transactions++;
+        if (open++) {
+            misuse = true;
+        }
+    }
+
+    void endTransaction()
+    {
+        if (!open--) {
+            misuse = true;
+        }
+    }
+
+    uint8_t transfer(uint8_t b)
+    {
+        put(b);
+        return 0;
+    }
+
+    void transfer(void *buffer, size_t n)
+    {
+        // The received bytes overwrite the buffer, as on the boards
+        uint8_t *p = (uint8_t *)buffer;
+        for (size_t i = 0; i < n; i++) {
+            put(p[i]);
+            p[i] = 0xEE;
+        }
+    }
+
+private:
+    void put(uint8_t b)
+    {
+        if (!open || csPin < 0 || pinLevel[csPin]) {
+            misuse = true;
+        }
+        const bool     dc  = dcPin >= 0 && pinLevel[dcPin];
+        const unsigned sel = csPin >= 0 ? pinRises[csPin] : 0;
+        if (log.empty() || sel != _select || log.back().data != dc) {
+            log.push_back({ dc, {} });
+            _select = sel;
+        }
+        log.back().bytes.push_back(b);
+    }
+
+    unsigned _select = 0;
+};
+
+extern SPIClass SPI;
+
+#endif // _ST7315_TEST_SPI_H
@@ -0,0 +1,74 @@
+/*
+  Copyright (c) 2026 Arduino SA
+  This Source Code Form is subject to the terms of the Mozilla
+  Public License (MPL), v 2.0. You can obtain a copy of the MPL
+  at http://mozilla.org/MPL/2.0/
+*/
+
+// Host stand-in for TwoWire: every transaction is logged instead of sent
+
+#ifndef _ST7315_TEST_WIRE_H
+#define _ST7315_TEST_WIRE_H
+
+#include <Arduino.h>
+#include <vector>
+
+#define BUFFER_LENGTH   32
+
+class TwoWire
+{
+public:
+    struct Transaction {
+        uint8_t                 address;
+        std::vector<uint8_t>    bytes;
+        bool                    stop;       // false: ended by a repeated START
+    };
+
+    std::vector<Transaction> log;
+    size_t      bufferLength = BUFFER_LENGTH;   // Bytes per transaction, as the TX buffer of the core
+    bool        bulkWriteLies = false;          // write(data, n) returns n even when the buffer is full, as on AVR
+    uint32_t    clock = 100000;
+
+    void begin() {}
+    void end() {}
+    void setClock(uint32_t frequency) { clock = frequency; }
+
+    void beginTransmission(uint8_t address)
+    {
+        _current = Transaction();
+        _current.address = address;
+    }
+
+    size_t write(uint8_t b)
+    {
+        if (_current.bytes.size() >= bufferLength) {
+            return 0;
+        }
+        _current.bytes.push_back(b);
+        return 1;
+    }
+
+    size_t write(const uint8_t *data, size_t n)
+    {
+        size_t written = 0;
+        while (written < n && write(data[written])) {
+            written++;
+        }
+        return bulkWriteLies ? n : written;
+    }
+
+    uint8_t endTransmission(bool stop = true)
+    {
+        _current.stop = stop;
+        log.push_back(_current);
+        return 0;
+    }
+
+private:
+    Transaction _current;
+};
+
+extern TwoWire Wire;
+extern TwoWire Wire1;
+
+#endif // _ST7315_TEST_WIRE_H
@@ -0,0 +1,68 @@
+/*
+  Copyright (c) 2026 Arduino SA
+  This Source Code Form is subject to the terms of the Mozilla
+  Public License (MPL), v 2.0. You can obtain a copy of the MPL
+  at http://mozilla.org/MPL/2.0/
+*/
+
+#ifndef _ST7315_TEST_H
+#define _ST7315_TEST_H
+
+#include <Arduino.h>
+#include <vector>
+
+// A failed check prints where it failed and fails the test function
+#define CHECK(cond)                                                             \
+    do {                                                                        \
+        if (!(cond)) {                                                          \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond);     \
+            return 1;                                                           \
+        }                                                                       \
+    } while (0)
+
+struct TestCase {
+    const char  *name;
+    int         (*run)();   // 0 on success
+};
+
+// Runs every test, the exit status of the test executable
+template <size_t N>
+int runTests(const TestCase (&tests)[N])
+{
+    int failed = 0;
+    for (const TestCase &t : tests) {
+        const int result = t.run();
+        printf("%-32s %s\n", t.name, result ? "FAILED" : "ok");
+        failed += result ? 1 : 0;
+    }
+    return failed ? 1 : 0;
+}
+
+// Expected panel content, in GDDRAM order like the driver framebuffer
+struct Frame {
+    int                     width;
+    int                     height;
+    std::vector<uint8_t>    bytes;
+
+    Frame(int w = 128, int h = 64) : width(w), height(h), bytes((w * h) / 8, 0) {}
+
+    bool get(int x, int y) const
+    {
+        return (bytes[x + (y / 8) * width] >> (y & 7)) & 1;
+    }
+
+    void set(int x, int y, bool on)     // Clipped
+    {
+        if (x < 0 || y < 0 || x >= width || y >= height) {
+            return;
+        }
+        uint8_t &b = bytes[x + (y / 8) * width];
+        b = on ? (b | (1 << (y & 7))) : (b & ~(1 << (y & 7)));
+    }
+
+    void fill(bool on) { std::fill(bytes.begin(), bytes.end(), on ? 0xFF : 0x00); }
+
+    const uint8_t *data() const { return bytes.data(); }
+};
+
+#endif // _ST7315_TEST_H
@@ -0,0 +1,170 @@
+/*
+  Copyright (c) 2026 Arduino SA
+  This Source Code Form is subject to the terms of the Mozilla
+  Public License (MPL), v 2.0. You can obtain a copy of the MPL
+  at http://mozilla.org/MPL/2.0/
+*/
+
+// Non-blocking flush: beginUpdate()/poll() budgets, drawing while busy and the
+// completion callback
+
+#include "Arduino_ST7315.h"
+#include "BusMonitor.h"
+#include "test.h"
+
+static int completed;
+
+static int testDrawWhileBusy()
+{
+    for (int diff = 0; diff < 2; diff++) {
+        Arduino_ST7315_Driver d(128, 64, &Wire1, 0x3D);
+        BusMonitor m;
+        Frame ref;
+
+        CHECK(d.begin());
+        m.feed(Wire1);
+        if (diff) {
+            CHECK(d.setDiffUpdate(true));
+        }
+        completed = 0;
+        d.onUpdateComplete([]() { completed++; });
+
+        srand(3 + diff);
+        for (int it = 0; it < 2000; it++) {
+            const int n = rand() % 60;
+            for (int k = 0; k < n; k++) {
+                const int  x  = rand() % 128, y = rand() % 64;
+                const bool on = rand() % 2;
+                d.set(x, y, on);
+                ref.set(x, y, on);
+            }
+            if (rand() % 3 == 0) {
+                d.beginUpdate();
+            }
+            d.poll(rand() % 100);
+            m.feed(Wire1);
+        }
+
+        d.update();
+        m.feed(Wire1);
+        CHECK(!d.isBusy());
+        CHECK(completed > 0);
+        CHECK(m.matches(ref.data()));
+    }
+    return 0;
+}
+
+static int testBudget()
+{
+    Arduino_ST7315_Driver d(128, 64, &Wire1, 0x3D);
+    CHECK(d.begin());
+    Wire1.log.clear();
+
+    // No budget: one transaction per call
+    d.invalidate();
+    d.beginUpdate();
+    CHECK(d.poll());
+    CHECK(Wire1.log.size() == 1);
+
+    // Byte budget: stops once it is spent
+    Wire1.log.clear();
+    CHECK(d.poll(64));
+    size_t bytes = 0;
+    for (const TwoWire::Transaction &t : Wire1.log) {
+        bytes += t.bytes.size();
+    }
+    CHECK(bytes >= 64 && bytes < 64 + 32);
+
+    // Time-only budget: no byte limit, a second is plenty for the whole frame
+    Wire1.log.clear();
+    CHECK(!d.poll(0, 1000000));
+    CHECK(!d.isBusy());
+    CHECK(Wire1.log.size() >= 10);
+    return 0;
+}
+
+// The completion callback runs with the bus released: another SPI device can use it,
+// and the next update can be started or even sent from there
+static Arduino_ST7315_Driver *callbackDisplay;
+static bool busFreeInCallback;
+
+static int testCallback()
+{
+    SPI.csPin = 10;
+    SPI.dcPin = 9;
+    Arduino_ST7315_SPIBus bus(&SPI, 10, 9, 8);
+    Arduino_ST7315_Driver d(128, 64, &bus);
+    callbackDisplay   = &d;
+    busFreeInCallback = true;
+    completed         = 0;
+
+    CHECK(d.begin());
+    d.onUpdateComplete([]() {
+        completed++;
+        busFreeInCallback &= (SPI.open == 0);
+        SPI.beginTransaction(SPISettings());
+        SPI.endTransaction();
+        if (completed == 1) {
+            callbackDisplay->set(5, 5, true);
+            callbackDisplay->beginUpdate();
+        } else if (completed == 2) {
+            callbackDisplay->set(6, 6, true);
+            callbackDisplay->update();
+        }
+    });
+
+    d.invalidate();
+    d.update();
+    CHECK(completed == 3);
+    CHECK(busFreeInCallback);
+    CHECK(!SPI.misuse && SPI.open == 0);
+    CHECK(!d.isBusy());
+
+    // beginUpdate() while busy: the pending pass follows the callback
+    completed = 10;
+    d.invalidate();
+    d.beginUpdate();
+    d.set(7, 7, true);
+    d.beginUpdate();
+    while (d.poll(SIZE_MAX)) {
+    }
+    CHECK(completed == 12);
+    CHECK(!SPI.misuse);
+    SPI.log.clear();
+    return 0;
+}
+
+static int testAsyncGraphics()
+{
+    Arduino_ST7315 display(128, 64, &Wire1, 0x3D);
+    BusMonitor m;
+
+    CHECK(display.begin());
+    m.feed(Wire1);
+    display.setAsyncUpdate(true);
+
+    display.beginDraw();
+    display.text("hi", 0, 0);
+    display.endDraw();
+    CHECK(display.isBusy());    // endDraw() only starts the transfer
+
+    int polls = 0;
+    while (display.poll()) {
+        polls++;
+    }
+    m.feed(Wire1);
+    CHECK(polls > 0);
+    CHECK(m.matches(display.framebuffer()));
+    return 0;
+}
+
+int main()
+{
+    static const TestCase tests[] = {
+        { "draw while busy",    testDrawWhileBusy },
+        { "poll budget",        testBudget },
+        { "update callback",    testCallback },
+        { "async graphics",     testAsyncGraphics },
+    };
+    return runTests(tests);
+}
@@ -0,0 +1,308 @@
+/*
+  Copyright (c) 2026 Arduino SA
+  This Source Code Form is subject to the terms of the Mozilla
+  Public License (MPL), v 2.0. You can obtain a copy of the MPL
+  at http://mozilla.org/MPL/2.0/
+*/
+
+// Drawing: the fast paths, the blit engine and the RLE decoder draw the same
+// pixels as the generic per-pixel ArduinoGraphics code
+
+#include "Arduino_ST7315.h"
+#include "BusMonitor.h"
+#include "test.h"
+
+#include "img_arduinologobw.h"
+#include "img_arduinologobw_1bpp.h"
+#include "img_arduinologobw_rle.h"
+
+// Generic ArduinoGraphics drawing into a reference frame
+class Reference : public ArduinoGraphics
+{
+public:
+    Frame frame;
+
+    Reference() : ArduinoGraphics(128, 64) {}
+
+    void set(int x, int y, uint8_t r, uint8_t g, uint8_t b) override
+    {
+        frame.set(x, y, (r | g | b) > 127);
+    }
+};
+
+static int testFastPaths()
+{
+    Arduino_ST7315 display(128, 64, &Wire1, 0x3D);
+    Reference ref;
+    BusMonitor m;
+
+    CHECK(display.begin());
+    m.feed(Wire1);
+    ref.background(0, 0, 0);
+    ref.stroke(255, 255, 255);
+    ref.noFill();
+    display.noFill();
+
+    srand(5);
+    for (int it = 0; it < 3000; it++) {
+        const int x0 = rand() % 150 - 10, y0 = rand() % 80 - 10;
+        const int x1 = rand() % 150 - 10, y1 = rand() % 80 - 10;
+        const uint8_t c = (rand() % 2) ? 255 : 0;
+
+        switch (rand() % 9) {
+        case 0:
+            display.stroke(c, c, c);
+            ref.stroke(c, c, c);
+            break;
+        case 1:
+            display.fill(c, c, c);
+            ref.fill(c, c, c);
+            break;
+        case 2:
+            if (rand() % 4 == 0) {
+                display.noFill();
+                ref.noFill();
+            } else {
+                display.noStroke();
+                ref.noStroke();
+            }
+            break;
+        case 3:
+            display.rect(x0, y0, x1 / 3, y1 / 3);
+            ref.rect(x0, y0, x1 / 3, y1 / 3);
+            break;
+        case 4:
+            display.line(x0, y0, x0, y1);
+            ref.line(x0, y0, x0, y1);
+            break;
+        case 5:
+            display.line(x0, y0, x1, y0);
+            ref.line(x0, y0, x1, y0);
+            break;
+        case 6:
+            display.line(x0, y0, x1, y1);
+            ref.line(x0, y0, x1, y1);
+            break;
+        case 7:
+            display.point(x0, y0);
+            ref.point(x0, y0);
+            break;
+        default:
+            if (rand() % 10 == 0) {
+                display.background(c, c, c);
+                ref.background(c, c, c);
+                display.clear();
+                ref.clear();
+            }
+            break;
+        }
+
+        if (rand() % 5 == 0) {
+            display.endDraw();
+            m.feed(Wire1);
+            CHECK(m.matches(ref.frame.data()));
+        }
+    }
+    return 0;
+}
+
+static int testBlit()
+{
+    Arduino_ST7315_Driver d(128, 64, &Wire1, 0x3D);
+    BusMonitor m;
+    Frame ref;
+
+    CHECK(d.begin());
+    m.feed(Wire1);
+
+    srand(6);
+    for (int it = 0; it < 3000; it++) {
+        const int w = rand() % 40 + 1, h = rand() % 40 + 1, x = rand() % 170 - 40, y = rand() % 110 - 45;
+        const Arduino_ST7315_RasterOp op = (Arduino_ST7315_RasterOp)(rand() % 5);
+        const bool rows = rand() % 2;
+
+        std::vector<uint8_t> pixels(w * h);
+        for (uint8_t &p : pixels) {
+            p = rand() % 2;
+        }
+
+        // Both layouts, with garbage in the padding bits that must be ignored
+        std::vector<uint8_t> data;
+        if (rows) {
+            const int stride = (w + 7) / 8;
+            data.assign(stride * h, 0);
+            for (int j = 0; j < h; j++) {
+                for (int i = 0; i < w; i++) {
+                    data[j * stride + i / 8] |= pixels[j * w + i] ? (0x80 >> (i & 7)) : 0;
+                }
+                if (w & 7) {
+                    data[j * stride + w / 8] |= (rand() % 256) & (0xFF >> (w & 7));
+                }
+            }
+        } else {
+            data.assign(((h + 7) / 8) * w, 0);
+            for (int j = 0; j < h; j++) {
+                for (int i = 0; i < w; i++) {
+                    data[(j / 8) * w + i] |= pixels[j * w + i] ? (1 << (j & 7)) : 0;
+                }
+            }
+            if (h & 7) {
+                for (int i = 0; i < w; i++) {
+                    data[((h - 1) / 8) * w + i] |= (rand() % 256) & (0xFF << (h & 7));
+                }
+            }
+        }
+
+        d.blit(data.data(), x, y, w, h, rows ? ST7315_BITMAP_ROWS : ST7315_BITMAP_PAGES, op);
+        for (int j = 0; j < h; j++) {
+            for (int i = 0; i < w; i++) {
+                const int X = x + i, Y = y + j;
+                if (X < 0 || Y < 0 || X >= 128 || Y >= 64) {
+                    continue;
+                }
+                const bool s = pixels[j * w + i], dst = ref.get(X, Y);
+                bool r;
+                switch (op) {
+                case ST7315_OP_COPY:    r = s;          break;
+                case ST7315_OP_OR:      r = dst | s;    break;
+                case ST7315_OP_AND:     r = dst & s;    break;
+                case ST7315_OP_XOR:     r = dst ^ s;    break;
+                default:                r = !s;         break;
+                }
+                ref.set(X, Y, r);
+            }
+        }
+
+        if (rand() % 4 == 0) {
+            d.update();
+            m.feed(Wire1);
+            CHECK(m.matches(ref.data()));
+        }
+    }
+    return 0;
+}
+
+// The 1bpp logo converted by st7315_imgconv.py draws like the RGB565 one through image()
+static int testImageBlit()
+{
+    Arduino_ST7315 a(128, 64, &Wire1, 0x3D), b(128, 64, &Wire, 0x3D);
+    BusMonitor ma, mb;
+    Image img(ENCODING_RGB16, (const uint8_t *)img_arduinologobw_raw, 60, 60);
+
+    CHECK(a.begin());
+    CHECK(b.begin());
+    for (int y = -3; y < 10; y++) {
+        a.background(255, 255, 255);
+        a.clear();
+        a.image(img, 34, y);
+        a.endDraw();
+        b.background(255, 255, 255);
+        b.clear();
+        b.blit(img_arduinologobw_1bpp, 34, y, 60, 60);
+        b.endDraw();
+        ma.feed(Wire1);
+        mb.feed(Wire);
+        CHECK(memcmp(ma.gddram(), mb.gddram(), 1024) == 0);
+    }
+    return 0;
+}
+
+// The RLE logo decodes to the same pixels as the packed one, clipped, with every
+// raster operation, a start line and page bands
+static int rleX, rleY;
+static Arduino_ST7315_RasterOp rleOp;
+static Arduino_ST7315_Driver *rleTarget;
+
+static void logoScene(bool rle)
+{
+    // Background the raster operations combine with, the same for every band
+    for (int y = 0; y < 64; y++) {
+        for (int x = 0; x < 128; x++) {
+            rleTarget->set(x, y, ((x * 7 + y * 13) ^ (x * y)) % 3 == 0);
+        }
+    }
+    if (rle) {
+        rleTarget->blitRLE(img_arduinologobw_rle, rleX, rleY, rleOp);
+    } else {
+        rleTarget->blit(img_arduinologobw_1bpp, rleX, rleY, img_arduinologobw_1bpp_width, img_arduinologobw_1bpp_height,
+                        ST7315_BITMAP_PAGES, rleOp);
+    }
+}
+
+static void packedScene() { logoScene(false); }
+static void rleScene() { logoScene(true); }
+
+static int testBlitRLE()
+{
+    CHECK(img_arduinologobw_rle_width == img_arduinologobw_1bpp_width);
+    CHECK(img_arduinologobw_rle_height == img_arduinologobw_1bpp_height);
+
+    for (int pages : { 0, 3 }) {
+        for (int startLine : { 0, 21 }) {
+            Arduino_ST7315_Driver packed(128, 64, &Wire1, 0x3D), rle(128, 64, &Wire, 0x3D);
+            BusMonitor mp, mr;
+
+            CHECK(rle.setBandPages(pages));
+            CHECK(packed.begin());
+            CHECK(rle.begin());
+            packed.setStartLine(startLine);
+            rle.setStartLine(startLine);
+
+            for (int x : { -45, -7, 0, 34, 100 }) {
+                for (int y : { -50, -3, 0, 2, 30 }) {
+                    for (int op = ST7315_OP_COPY; op <= ST7315_OP_NOT; op++) {
+                        rleX  = x;
+                        rleY  = y;
+                        rleOp = (Arduino_ST7315_RasterOp)op;
+                        rleTarget = &packed;
+                        packed.drawBands(packedScene);
+                        rleTarget = &rle;
+                        rle.drawBands(rleScene);
+                        mp.feed(Wire1);
+                        mr.feed(Wire);
+                        CHECK(memcmp(mp.gddram(), mr.gddram(), 1024) == 0);
+                        CHECK(mp.matches(packed.framebuffer()));
+                    }
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+// Hardware text scroll moves the start line instead of redrawing the text
+static int testHardwareTextScroll()
+{
+    uint32_t bytes[2];
+    for (int hw = 0; hw < 2; hw++) {
+        Arduino_ST7315 display(128, 64, &Wire1, 0x3D);
+        BusMonitor m;
+
+        CHECK(display.begin());
+        m.feed(Wire1);
+        m.reset();
+        display.setHardwareTextScroll(hw);
+        display.textSize(2);
+        display.textScrollSpeed(1);
+        display.beginText(0, 0, 255, 255, 255);
+        display.print("scroll");
+        display.endText(SCROLL_UP);
+        m.feed(Wire1);
+        bytes[hw] = m.bytes();
+        CHECK(m.matches(display.framebuffer()));
+    }
+    CHECK(bytes[1] < bytes[0]);
+    return 0;
+}
+
+int main()
+{
+    static const TestCase tests[] = {
+        { "fast paths",             testFastPaths },
+        { "blit",                   testBlit },
+        { "image and blit",         testImageBlit },
+        { "RLE and blit",           testBlitRLE },
+        { "hardware text scroll",   testHardwareTextScroll },
+    };
+    return runTests(tests);
+}
@@ -0,0 +1,181 @@
+/*
+  Copyright (c) 2026 Arduino SA
+  This Source Code Form is subject to the terms of the Mozilla
+  Public License (MPL), v 2.0. You can obtain a copy of the MPL
+  at http://mozilla.org/MPL/2.0/
+*/
+
+// Rotation: for every rotation, the panel shows the drawing turned clockwise,
+// with the runtime driver and with DriverT
+
+#include "Arduino_ST7315.h"
+#include "BusMonitor.h"
+#include "test.h"
+
+// Logical pixel of the drawing shown at panel position x, y
+static bool expected(Arduino_ST7315_Driver &d, int rotation, int width, int height, int x, int y)
+{
+    switch (rotation) {
+    case ST7315_ROTATION_0:     return d.get(x, y);
+    case ST7315_ROTATION_90:    return d.get(y, width - 1 - x);
+    case ST7315_ROTATION_180:   return d.get(width - 1 - x, height - 1 - y);
+    default:                    return d.get(height - 1 - y, x);
+    }
+}
+
+static int checkView(const BusMonitor &m, Arduino_ST7315_Driver &d, int rotation, int width, int height)
+{
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            CHECK(m.visible(x, y) == expected(d, rotation, width, height, x, y));
+        }
+    }
+    return 0;
+}
+
+static int checkRotations(Arduino_ST7315_Driver &d, TwoWire &wire, int width, int height)
+{
+    BusMonitor m(width, height);
+    static uint8_t logo[60 * 8];
+    for (uint8_t &b : logo) {
+        b = rand();
+    }
+
+    CHECK(d.begin());
+    for (int rotation = 0; rotation < 4; rotation++) {
+        for (int rep = 0; rep < 2; rep++) {
+            CHECK(d.setRotation((Arduino_ST7315_Rotation)rotation));
+            const int w = (rotation & 1) ? height : width;
+            const int h = (rotation & 1) ? width : height;
+            CHECK(d.width() == w && d.height() == h);
+
+            for (int i = 0; i < 300; i++) {
+                d.set(rand() % (w + 4) - 2, rand() % (h + 4) - 2, rand() % 2);
+            }
+            for (int i = 0; i < 10; i++) {
+                d.fillRect(rand() % w - 5, rand() % h - 5, rand() % 30, rand() % 30, rand() % 2);
+            }
+            for (int i = 0; i < 5; i++) {
+                const Arduino_ST7315_BitmapLayout layout = (Arduino_ST7315_BitmapLayout)(rand() % 2);
+                d.blit(logo, rand() % w - 20, rand() % h - 20, 60, 1 + rand() % 60, layout,
+                       (Arduino_ST7315_RasterOp)(rand() % 5));
+            }
+            d.update();
+            m.feed(wire);
+            CHECK(checkView(m, d, rotation, width, height) == 0);
+
+            // A single pixel only sends its 8x8 block, addressing included
+            const int x = rand() % w, y = rand() % h;
+            m.reset();
+            d.set(x, y, !d.get(x, y));
+            d.update();
+            m.feed(wire);
+            CHECK(m.bytes() <= 8 + 20);
+            CHECK(checkView(m, d, rotation, width, height) == 0);
+        }
+    }
+
+    // Quarter turns keep the framebuffer in drawing order: no diff flush, no bands, no start line
+    CHECK(d.setRotation(ST7315_ROTATION_90));
+    CHECK(!d.setDiffUpdate(true));
+    CHECK(!d.setBandPages(2));
+    d.setStartLine(5);
+    CHECK(d.startLine() == 0);
+    return 0;
+}
+
+static int testDriver()
+{
+    Arduino_ST7315_Driver d64(128, 64, &Wire, 0x3D);
+    CHECK(checkRotations(d64, Wire, 128, 64) == 0);
+    Arduino_ST7315_Driver d32(128, 32, &Wire, 0x3D);
+    CHECK(checkRotations(d32, Wire, 128, 32) == 0);
+    Arduino_ST7315_Driver d72(72, 40, &Wire, 0x3D);
+    CHECK(checkRotations(d72, Wire, 72, 40) == 0);
+
+    // Quarter turns need a width made of whole 8x8 blocks
+    Arduino_ST7315_Driver d100(100, 16, &Wire, 0x3D);
+    CHECK(d100.begin());
+    CHECK(!d100.setRotation(ST7315_ROTATION_90));
+    CHECK(d100.setRotation(ST7315_ROTATION_180));
+    Wire.log.clear();
+    return 0;
+}
+
+static int testDriverT()
+{
+    Arduino_ST7315_DriverT<128, 64> d(&Wire1, 0x3D);
+    CHECK(checkRotations(d, Wire1, 128, 64) == 0);
+    Wire1.log.clear();
+    return 0;
+}
+
+// A half turn only flips the scan directions, the start line still applies
+static int testHalfTurnStartLine()
+{
+    Arduino_ST7315_Driver d(128, 64, &Wire, 0x3D);
+    BusMonitor m;
+
+    CHECK(d.begin());
+    CHECK(d.setRotation(ST7315_ROTATION_180));
+    d.setStartLine(9);
+    for (int i = 0; i < 500; i++) {
+        d.set(rand() % 128, rand() % 64, true);
+    }
+    d.update();
+    m.feed(Wire);
+    CHECK(checkView(m, d, ST7315_ROTATION_180, 128, 64) == 0);
+    return 0;
+}
+
+static int testGraphicsPortrait()
+{
+    Arduino_ST7315 display(128, 64, &Wire, 0x3D, ST7315_ROTATION_270);
+    BusMonitor m;
+
+    CHECK(display.begin());
+    CHECK(display.width() == 64 && display.height() == 128);
+    CHECK(!display.setRotation(ST7315_ROTATION_0));     // Would change the drawing surface size
+    CHECK(display.setRotation(ST7315_ROTATION_90));
+
+    display.beginDraw();
+    display.rect(2, 2, 20, 100);
+    display.text("Hi", 3, 110);
+    display.endDraw();
+    m.feed(Wire);
+    for (int y = 0; y < 64; y++) {
+        for (int x = 0; x < 128; x++) {
+            CHECK(m.visible(x, y) == display.get(y, 127 - x));
+        }
+    }
+    return 0;
+}
+
+// A quarter turn the panel cannot do leaves the display unrotated, surface included
+static int testGraphicsInvalidRotation()
+{
+    Arduino_ST7315 display(100, 16, &Wire, 0x3D, ST7315_ROTATION_90);
+
+    CHECK(display.rotation() == ST7315_ROTATION_0);
+    CHECK(display.width() == 100 && display.height() == 16);
+    CHECK(display.begin());
+
+    display.beginDraw();
+    display.rect(0, 0, 100, 16);
+    display.endDraw();
+    CHECK(display.get(99, 15) && display.get(0, 15) && !display.get(50, 8));
+    Wire.log.clear();
+    return 0;
+}
+
+int main()
+{
+    static const TestCase tests[] = {
+        { "rotations",              testDriver },
+        { "rotations DriverT",      testDriverT },
+        { "half turn start line",   testHalfTurnStartLine },
+        { "portrait graphics",      testGraphicsPortrait },
+        { "invalid rotation",       testGraphicsInvalidRotation },
+    };
+    return runTests(tests);
+}
@@ -0,0 +1,106 @@
+/*
+  Copyright (c) 2026 Arduino SA
+  This Source Code Form is subject to the terms of the Mozilla
+  Public License (MPL), v 2.0. You can obtain a copy of the MPL
+  at http://mozilla.org/MPL/2.0/
+*/
+
+// SPI transport: the same panel content as over I2C, commands and data told apart
+// by the D/C pin, one SPI transaction per frame
+
+#include "Arduino_ST7315.h"
+#include "BusMonitor.h"
+#include "test.h"
+
+#define PIN_CS      10
+#define PIN_DC      9
+#define PIN_RST     8
+
+static int testSameAsI2C()
+{
+    SPI.csPin = PIN_CS;
+    SPI.dcPin = PIN_DC;
+    Arduino_ST7315_SPIBus bus(&SPI, PIN_CS, PIN_DC, PIN_RST);
+    Arduino_ST7315_Driver spi(128, 64, &bus), i2c(128, 64, &Wire1, 0x3D);
+    BusMonitor ms, mi;
+
+    CHECK(spi.begin());
+    CHECK(i2c.begin());
+    ms.feed(SPI);
+    mi.feed(Wire1);
+    CHECK(memcmp(ms.gddram(), mi.gddram(), 1024) == 0);
+    CHECK(spi.transferSize() == ST7315_SPI_TRANSFER_SIZE);
+    spi.setAddressing(ST7315_ADDRESSING_CONTINUATION);
+
+    for (int it = 0; it < 1500; it++) {
+        for (Arduino_ST7315_Driver *d : { &spi, &i2c }) {
+            srand(it * 7);
+            const int op = rand() % 3;
+            if (op == 0) {
+                d->set(rand() % 128, rand() % 64, rand() % 2);
+            } else if (op == 1) {
+                d->fillRect(rand() % 140 - 6, rand() % 70 - 3, rand() % 30, rand() % 30, rand() % 2);
+            } else if (rand() % 10 == 0) {
+                d->scrollVertical(rand() % 9 - 4);
+            }
+        }
+
+        if (it % 5 == 0) {
+            const int transactions = SPI.transactions;
+            if (it % 2) {
+                spi.update();
+                CHECK(SPI.transactions - transactions <= 1);    // The bus is claimed once per frame
+            } else {
+                spi.beginUpdate();
+                while (spi.poll(100)) {
+                }
+            }
+            i2c.update();
+
+            ms.feed(SPI);
+            mi.feed(Wire1);
+            CHECK(!SPI.misuse);
+            CHECK(memcmp(ms.gddram(), mi.gddram(), 1024) == 0);
+            CHECK(ms.startLine() == mi.startLine());
+            CHECK(ms.matches(spi.framebuffer()));
+        }
+    }
+
+    // No control bytes: a full frame costs fewer bytes than over I2C
+    spi.invalidate();
+    i2c.invalidate();
+    spi.update();
+    i2c.update();
+    ms.reset();
+    mi.reset();
+    ms.feed(SPI);
+    mi.feed(Wire1);
+    CHECK(ms.bytes() < mi.bytes());
+    return 0;
+}
+
+static int testGraphics()
+{
+    Arduino_ST7315_SPIBus bus(&SPI, PIN_CS, PIN_DC, PIN_RST);
+    Arduino_ST7315 display(128, 64, &bus);
+    BusMonitor m;
+
+    CHECK(display.begin());
+    display.beginDraw();
+    display.rect(0, 0, 10, 10);
+    display.text("SPI", 20, 20);
+    display.endDraw();
+    m.feed(SPI);
+    CHECK(!SPI.misuse);
+    CHECK(m.matches(display.framebuffer()));
+    return 0;
+}
+
+int main()
+{
+    static const TestCase tests[] = {
+        { "same panel as I2C",  testSameAsI2C },
+        { "SPI graphics",       testGraphics },
+    };
+    return runTests(tests);
+}
@@ -0,0 +1,254 @@
+/*
+  Copyright (c) 2026 Arduino SA
+  This Source Code Form is subject to the terms of the Mozilla
+  Public License (MPL), v 2.0. You can obtain a copy of the MPL
+  at http://mozilla.org/MPL/2.0/
+*/
+
+// Sprites: moved over a random background, the frame is the background plus the
+// sprites, hiding restores the background exactly, and a move only resends the
+// old and new rectangles
+
+#include "Arduino_ST7315_Driver.h"
+#include "BusMonitor.h"
+#include "test.h"
+
+#define SPRITES     3
+
+static uint8_t bitmaps[SPRITES][96];
+static const int spriteW[SPRITES] = { 9, 16, 5 };
+static const int spriteH[SPRITES] = { 9, 12, 20 };
+static const Arduino_ST7315_BitmapLayout spriteLayout[SPRITES] = { ST7315_BITMAP_ROWS, ST7315_BITMAP_PAGES, ST7315_BITMAP_ROWS };
+
+static bool spritePixel(int i, int x, int y)
+{
+    if (spriteLayout[i] == ST7315_BITMAP_ROWS) {
+        return (bitmaps[i][y * ((spriteW[i] + 7) / 8) + x / 8] >> (7 - (x & 7))) & 1;
+    }
+    return (bitmaps[i][(y / 8) * spriteW[i] + x] >> (y & 7)) & 1;
+}
+
+// Bytes a move may send: the columns the old and new rectangles span, on each
+// GDDRAM page they touch, plus a control byte per transfer and the addressing of
+// every window. Neighbouring pages may be merged into one window, so the column
+// span is taken over both rectangles.
+static size_t moveLimit(int i, int startLine, bool wasVisible, int oldX, int oldY, int x, int y)
+{
+    bool touched[8] = { false };
+    int  lo = 128, hi = -1;
+
+    auto mark = [&](int rx, int ry) {
+        for (int row = max(ry, 0); row < min(ry + spriteH[i], 64); row++) {
+            touched[((row + startLine) % 64) / 8] = true;
+        }
+        if (ry < 64 && ry + spriteH[i] > 0) {
+            lo = min(lo, max(rx, 0));
+            hi = max(hi, min(rx + spriteW[i], 128) - 1);
+        }
+    };
+    mark(x, y);
+    if (wasVisible) {
+        mark(oldX, oldY);
+    }
+
+    const int columns = hi - lo + 1;
+    size_t limit = 0;
+    for (int p = 0; p < 8; p++) {
+        if (touched[p]) {
+            limit += columns + (columns + BUFFER_LENGTH - 2) / (BUFFER_LENGTH - 1) + 7;
+        }
+    }
+    return limit;
+}
+
+// Framebuffer content in drawing order, whatever the start line
+static bool sameAs(const Arduino_ST7315_Driver &d, const Frame &frame)
+{
+    for (int y = 0; y < 64; y++) {
+        for (int x = 0; x < 128; x++) {
+            if (d.get(x, y) != frame.get(x, y)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static int checkSprites(Arduino_ST7315_SpriteMode mode, int startLine)
+{
+    Arduino_ST7315_Driver d(128, 64, &Wire, 0x3D);
+    BusMonitor m;
+    Frame background;
+
+    CHECK(d.begin());
+    m.feed(Wire);
+    d.setStartLine(startLine);
+    for (int y = 0; y < 64; y++) {
+        for (int x = 0; x < 128; x++) {
+            const bool on = rand() % 3 == 0;
+            d.set(x, y, on);
+            background.set(x, y, on);
+        }
+    }
+    d.update();
+    m.feed(Wire);
+
+    // Save-under sprites must not overlap each other
+    const int count = (mode == ST7315_SPRITE_SAVE_UNDER) ? 1 : SPRITES;
+    int ids[SPRITES], xs[SPRITES] = { 0 }, ys[SPRITES] = { 0 };
+    for (int i = 0; i < count; i++) {
+        ids[i] = d.addSprite(bitmaps[i], spriteW[i], spriteH[i], mode, spriteLayout[i]);
+        CHECK(ids[i] >= 0);
+        CHECK(!d.spriteVisible(ids[i]));
+    }
+
+    for (int step = 0; step < 200; step++) {
+        for (int i = 0; i < count; i++) {
+            const int  oldX = xs[i], oldY = ys[i];
+            const bool wasVisible = d.spriteVisible(ids[i]);
+
+            if (i == 0 && step % 7 == 3) {
+                d.hideSprite(ids[i]);
+                CHECK(!d.spriteVisible(ids[i]));
+                d.update();
+                m.feed(Wire);
+                continue;
+            }
+
+            // Partly off-screen positions included
+            xs[i] = rand() % 150 - 15;
+            ys[i] = rand() % 90 - 20;
+            d.moveSprite(ids[i], xs[i], ys[i]);
+            CHECK(d.spriteVisible(ids[i]));
+
+            m.reset();
+            d.update();
+            m.feed(Wire);
+            CHECK(m.bytes() <= moveLimit(i, startLine, wasVisible, oldX, oldY, xs[i], ys[i]));
+        }
+    }
+    for (int i = 0; i < count; i++) {
+        d.moveSprite(ids[i], xs[i], ys[i]);
+    }
+
+    // Background plus the sprites, XORed or drawn on
+    for (int y = 0; y < 64; y++) {
+        for (int x = 0; x < 128; x++) {
+            bool on = background.get(x, y);
+            for (int i = 0; i < count; i++) {
+                const int sx = x - xs[i], sy = y - ys[i];
+                if (sx < 0 || sy < 0 || sx >= spriteW[i] || sy >= spriteH[i]) {
+                    continue;
+                }
+                const bool bit = spritePixel(i, sx, sy);
+                on = (mode == ST7315_SPRITE_XOR) ? (on ^ bit) : (on | bit);
+            }
+            CHECK(d.get(x, y) == on);
+        }
+    }
+    d.update();
+    m.feed(Wire);
+    CHECK(m.matches(d.framebuffer()));
+
+    // Hidden, the background is back exactly, on the panel too
+    for (int i = 0; i < count; i++) {
+        d.hideSprite(ids[i]);
+    }
+    CHECK(sameAs(d, background));
+    d.update();
+    m.feed(Wire);
+    CHECK(m.matches(d.framebuffer()));
+
+    // Shown and removed again
+    for (int i = 0; i < count; i++) {
+        d.moveSprite(ids[i], xs[i], ys[i]);
+        d.removeSprite(ids[i]);
+        CHECK(!d.spriteVisible(ids[i]));
+    }
+    CHECK(sameAs(d, background));
+    return 0;
+}
+
+static int testSprites()
+{
+    for (auto &bitmap : bitmaps) {
+        for (uint8_t &b : bitmap) {
+            b = rand();
+        }
+    }
+
+    for (int startLine : { 0, 19 }) {
+        CHECK(checkSprites(ST7315_SPRITE_XOR, startLine) == 0);
+        CHECK(checkSprites(ST7315_SPRITE_SAVE_UNDER, startLine) == 0);
+    }
+    Wire.log.clear();
+    return 0;
+}
+
+// clear() wipes the sprites with the rest of the screen, moveSprite() shows them again
+static int testClear()
+{
+    Arduino_ST7315_Driver d(128, 64, &Wire, 0x3D);
+
+    CHECK(d.begin());
+    for (Arduino_ST7315_SpriteMode mode : { ST7315_SPRITE_XOR, ST7315_SPRITE_SAVE_UNDER }) {
+        d.fillScreen(true);
+        const int id = d.addSprite(bitmaps[1], spriteW[1], spriteH[1], mode, spriteLayout[1]);
+        CHECK(id >= 0);
+        d.moveSprite(id, 10, 20);
+
+        d.clear();
+        CHECK(!d.spriteVisible(id));
+        for (int y = 0; y < 64; y++) {
+            for (int x = 0; x < 128; x++) {
+                CHECK(!d.get(x, y));
+            }
+        }
+
+        // Shown over the cleared screen, hidden without bringing the old background back
+        d.moveSprite(id, 10, 20);
+        CHECK(d.spriteVisible(id));
+        d.hideSprite(id);
+        for (int y = 0; y < 64; y++) {
+            for (int x = 0; x < 128; x++) {
+                CHECK(!d.get(x, y));
+            }
+        }
+        d.removeSprite(id);
+    }
+    Wire.log.clear();
+    return 0;
+}
+
+static int testSlots()
+{
+    Arduino_ST7315_Driver d(128, 64, &Wire, 0x3D);
+
+    CHECK(d.begin());
+    for (int i = 0; i < ST7315_MAX_SPRITES; i++) {
+        CHECK(d.addSprite(bitmaps[0], 8, 8) == i);
+    }
+    CHECK(d.addSprite(bitmaps[0], 8, 8) == -1);
+    d.removeSprite(2);
+    CHECK(d.addSprite(bitmaps[0], 8, 8) == 2);
+
+    CHECK(d.addSprite(bitmaps[0], 129, 8) == -1);
+
+    // Page bands do not keep the screen to erase from
+    Arduino_ST7315_Driver band(128, 64, &Wire, 0x3D);
+    CHECK(band.setBandPages(2));
+    CHECK(band.begin());
+    CHECK(band.addSprite(bitmaps[0], 8, 8) == -1);
+    Wire.log.clear();
+    return 0;
+}
+
+int main()
+{
+    static const TestCase tests[] = {
+        { "sprites",    testSprites },
+        { "clear",      testClear },
+        { "slots",      testSlots },
+    };
+    return runTests(tests);
+}
@@ -0,0 +1,117 @@
+/*
+  Copyright (c) 2026 Arduino SA
+  This Source Code Form is subject to the terms of the Mozilla
+  Public License (MPL), v 2.0. You can obtain a copy of the MPL
+  at http://mozilla.org/MPL/2.0/
+*/
+
+// Runtime statistics and trace hooks, built against the library with ST7315_STATS=1
+
+#include <chrono>
+#include <thread>
+
+#include "Arduino_ST7315.h"
+#include "test.h"
+
+#if !ST7315_STATS
+#error "test_stats needs the library built with ST7315_STATS=1"
+#endif
+
+static std::vector<Arduino_ST7315_Event> events;
+
+static size_t loggedBytes(const TwoWire &wire)
+{
+    size_t bytes = 0;
+    for (const TwoWire::Transaction &t : wire.log) {
+        bytes += t.bytes.size();
+    }
+    return bytes;
+}
+
+static int testCounters()
+{
+    Arduino_ST7315_Driver d(128, 64, &Wire1, 0x3D);
+    CHECK(d.begin());
+    Wire1.log.clear();
+    d.resetStats();
+
+    d.set(1, 1, true);
+    d.fillRect(0, 0, 10, 10, true);
+    d.fillRect(-5, 60, 10, 10, true);   // 5 x 4 pixels on screen
+    d.update();
+
+    const Arduino_ST7315_Stats &stats = d.stats();
+    CHECK(stats.frames == 1);
+    CHECK(stats.bytes == loggedBytes(Wire1));
+    CHECK(stats.transactions == Wire1.log.size());
+    CHECK(stats.framePixels == 1 + 100 + 20);
+    CHECK(stats.updateMicrosAverage() <= stats.updateMicrosMax);
+
+    // DriverT counts its inline set() too, clipped pixels excluded
+    Arduino_ST7315_DriverT<128, 64> t(&Wire1, 0x3D);
+    CHECK(t.begin());
+    t.resetStats();
+    t.set(3, 3, true);
+    t.set(200, 3, true);
+    t.update();
+    CHECK(t.stats().framePixels == 1);
+    Wire1.log.clear();
+    return 0;
+}
+
+// An asynchronous flush only counts the time spent in poll(), not the sketch
+// running between the calls
+static int testAsyncFlushTime()
+{
+    Arduino_ST7315_Driver d(128, 64, &Wire1, 0x3D);
+    CHECK(d.begin());
+    d.resetStats();
+
+    d.fillScreen(true);
+    d.beginUpdate();
+    int polls = 0;
+    while (d.poll(64)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        polls++;
+    }
+    CHECK(polls >= 10);
+    CHECK(d.stats().frames == 1);
+    CHECK(d.stats().updateMicrosMax < 2000UL * polls);
+    Wire1.log.clear();
+    return 0;
+}
+
+static int testTraceHook()
+{
+    Arduino_ST7315_Driver d(128, 64, &Wire1, 0x3D);
+    CHECK(d.begin());
+    d.setTraceHook([](Arduino_ST7315_Event event) { events.push_back(event); });
+
+    events.clear();
+    d.set(1, 1, true);
+    d.update();
+    CHECK(events.size() == 2);
+    CHECK(events[0] == ST7315_EVENT_FLUSH_BEGIN);
+    CHECK(events[1] == ST7315_EVENT_FLUSH_END);
+
+    // Render and flush once per band
+    events.clear();
+    CHECK(d.setBandPages(2));
+    d.drawBands([]() {});
+    CHECK(events.size() == 4 * 4);
+    CHECK(events[0] == ST7315_EVENT_RENDER_BEGIN);
+    CHECK(events[1] == ST7315_EVENT_RENDER_END);
+    CHECK(events[2] == ST7315_EVENT_FLUSH_BEGIN);
+    Wire1.log.clear();
+    return 0;
+}
+
+int main()
+{
+    static const TestCase tests[] = {
+        { "counters",           testCounters },
+        { "async flush time",   testAsyncFlushTime },
+        { "trace hook",         testTraceHook },
+    };
+    return runTests(tests);
+}
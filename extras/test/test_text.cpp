@@ -0,0 +1,260 @@
+/*
+  Copyright (c) 2026 Arduino SA
+  This Source Code Form is subject to the terms of the Mozilla
+  Public License (MPL), v 2.0. You can obtain a copy of the MPL
+  at http://mozilla.org/MPL/2.0/
+*/
+
+// Text and colors: cached glyphs draw the same pixels as the generic ArduinoGraphics
+// bitmap(), text is drawn in its own color whatever the stroke, and the fast paths
+// follow colors set through an ArduinoGraphics reference
+
+#include <cstring>
+
+#include "Arduino_ST7315.h"
+#include "test.h"
+
+// Generic ArduinoGraphics drawing into a reference frame
+class Reference : public ArduinoGraphics
+{
+public:
+    Frame frame;
+
+    Reference() : ArduinoGraphics(128, 64) {}
+
+    void set(int x, int y, uint8_t r, uint8_t g, uint8_t b) override
+    {
+        frame.set(x, y, (r | g | b) > 127);
+    }
+};
+
+// Reaches the start line, which moves the page boundaries the glyphs are cached for
+class Display : public Arduino_ST7315
+{
+public:
+    using Arduino_ST7315::Arduino_ST7315;
+
+    void setStartLine(int line) { _driver.setStartLine(line); }
+};
+
+static int testGlyphCache()
+{
+    static uint8_t glyphs[40][24];
+    for (auto &glyph : glyphs) {
+        for (uint8_t &b : glyph) {
+            b = rand();
+        }
+    }
+
+    // No cache, a single slot evicted at every glyph, and a cache for the whole set
+    for (int cacheSize : { 0, 1, 32 }) {
+        for (int startLine : { 0, 21 }) {
+            Display cached(128, 64, &Wire, 0x3D);
+            Display generic(128, 64, &Wire1, 0x3D);
+
+            CHECK(cached.begin() && generic.begin());
+            cached.setGlyphCacheSize(cacheSize);
+            cached.setStartLine(startLine);
+            generic.setStartLine(startLine);
+
+            for (int it = 0; it < 4000; it++) {
+                const int stroke = rand() % 3, background = rand() % 2;
+                for (Display *d : { &cached, &generic }) {
+                    d->background(background ? 255 : 0, 0, 0);
+                    if (stroke == 2) {
+                        d->noStroke();
+                    } else {
+                        d->stroke(stroke ? 255 : 0, 0, 0);
+                    }
+                }
+
+                // A bitmap kept in RAM changes, the cache is told
+                if (it % 500 == 0) {
+                    for (uint8_t &b : glyphs[3]) {
+                        b = rand();
+                    }
+                    cached.clearGlyphCache();
+                }
+
+                const uint8_t *data = glyphs[rand() % 40];
+                const int w = 1 + rand() % 9, h = 1 + rand() % 17;
+                const int x = rand() % 150 - 15, y = rand() % 90 - 20;
+                const int sx = rand() % 4, sy = rand() % 5;
+                cached.bitmap(data, x, y, w, h, sx, sy);
+                generic.ArduinoGraphics::bitmap(data, x, y, w, h, sx, sy);
+                CHECK(memcmp(cached.framebuffer(), generic.framebuffer(), 128 * 64 / 8) == 0);
+            }
+
+            // One row stretched over the full 64-row column
+            cached.stroke(255, 255, 255);
+            generic.stroke(255, 255, 255);
+            cached.bitmap(glyphs[0], 7, 0, 8, 1, 2, 64);
+            generic.ArduinoGraphics::bitmap(glyphs[0], 7, 0, 8, 1, 2, 64);
+            CHECK(memcmp(cached.framebuffer(), generic.framebuffer(), 128 * 64 / 8) == 0);
+        }
+    }
+    Wire.log.clear();
+    Wire1.log.clear();
+    return 0;
+}
+
+// Draws "AB" with beginText() in the given color over the given stroke, on both
+// the display and the reference, and compares them
+static int checkText(bool stroke, uint8_t strokeLevel, uint32_t textColor)
+{
+    Arduino_ST7315 display(128, 64, &Wire, 0x3D);
+    Reference ref;
+
+    CHECK(display.begin());
+    for (ArduinoGraphics *g : { (ArduinoGraphics *)&display, (ArduinoGraphics *)&ref }) {
+        g->background(0, 0, 0);
+        g->clear();
+        g->textFont(Font_5x7);
+    }
+    if (stroke) {
+        display.stroke(strokeLevel, strokeLevel, strokeLevel);
+        ref.stroke(strokeLevel, strokeLevel, strokeLevel);
+    } else {
+        display.noStroke();
+        ref.noStroke();
+    }
+
+    display.beginText(3, 10, textColor);
+    display.print("AB");
+    display.endText();
+    ref.beginText(3, 10, textColor);
+    ref.print("AB");
+    ref.endText();
+
+    int lit = 0;
+    for (int y = 0; y < 64; y++) {
+        for (int x = 0; x < 128; x++) {
+            CHECK(display.get(x, y) == ref.frame.get(x, y));
+            lit += display.get(x, y);
+        }
+    }
+    CHECK((lit > 0) == (textColor != 0));
+
+    // The stroke is back to what it was: a line after the text follows it
+    display.line(0, 40, 127, 40);
+    for (int x = 0; x < 128; x++) {
+        CHECK(display.get(x, 40) == (stroke && strokeLevel > 127));
+    }
+    Wire.log.clear();
+    return 0;
+}
+
+static int testTextColor()
+{
+    CHECK(checkText(false, 0, 0xFFFFFF) == 0);      // noStroke()
+    CHECK(checkText(true, 0, 0xFFFFFF) == 0);       // Black stroke, white text
+    CHECK(checkText(true, 255, 0x000000) == 0);     // White stroke, black text
+    CHECK(checkText(true, 255, 0xFFFFFF) == 0);
+    return 0;
+}
+
+// beginText() without a color keeps the last text color
+static int testTextColorKept()
+{
+    Arduino_ST7315 display(128, 64, &Wire, 0x3D);
+
+    CHECK(display.begin());
+    display.noStroke();
+    display.beginText(0, 0);
+    display.print("A");
+    display.endText();
+    int lit = 0;
+    for (int y = 0; y < 64; y++) {
+        for (int x = 0; x < 128; x++) {
+            lit += display.get(x, y);
+        }
+    }
+    CHECK(lit > 0);
+
+    display.clear();
+    display.beginText(0, 0, 0x000000);
+    display.endText();
+    display.beginText(0, 0);
+    display.print("A");
+    display.endText();
+    for (int y = 0; y < 64; y++) {
+        for (int x = 0; x < 128; x++) {
+            CHECK(!display.get(x, y));
+        }
+    }
+    Wire.log.clear();
+    return 0;
+}
+
+// The color setters of ArduinoGraphics are not virtual: colors set through a
+// base class reference must still reach the fast paths
+static int testBaseReference()
+{
+    Arduino_ST7315 display(128, 64, &Wire, 0x3D);
+    Reference ref;
+
+    CHECK(display.begin());
+    ArduinoGraphics &g = display;
+
+    // White background, black text: the glyphs are black
+    g.background(255, 255, 255);
+    g.clear();
+    g.stroke(0, 0, 0);
+    g.text("AAAA", 0, 0);
+    for (int y = 0; y < 7; y++) {
+        for (int x = 0; x < 20; x++) {
+            CHECK(!display.get(x, y) == ((Font_5x7.data['A'][y] << (x % 5)) & 0x80) >> 7);
+        }
+    }
+
+    srand(11);
+    for (int it = 0; it < 3000; it++) {
+        const int x0 = rand() % 150 - 10, y0 = rand() % 80 - 10;
+        const int x1 = rand() % 150 - 10, y1 = rand() % 80 - 10;
+        const uint8_t c = (rand() % 2) ? 255 : 0;
+
+        for (ArduinoGraphics *d : { &g, (ArduinoGraphics *)&ref }) {
+            switch (it % 10) {
+            case 0:     d->background(c, c, c);             break;
+            case 1:     d->stroke(c, 0, 0);                 break;
+            case 2:     d->fill(0, 0, c);                   break;
+            case 3:     (c ? d->noFill() : d->noStroke());  break;
+            case 4:     d->rect(x0, y0, x1 / 3, y1 / 3);    break;
+            case 5:     d->line(x0, y0, x0, y1);            break;
+            case 6:     d->line(x0, y0, x1, y0);            break;
+            case 7:     d->point(x0, y0);                   break;
+            case 8:     d->text("Hi!", x0, y0);             break;
+            default:
+                if (it % 500 == 9) {
+                    d->clear();
+                }
+                break;
+            }
+        }
+        // clear() is not virtual: the fast one, called directly, also follows
+        if (it % 500 == 19) {
+            display.clear();
+            ref.clear();
+        }
+        if (it % 100 == 99) {
+            for (int y = 0; y < 64; y++) {
+                for (int x = 0; x < 128; x++) {
+                    CHECK(display.get(x, y) == ref.frame.get(x, y));
+                }
+            }
+        }
+    }
+    Wire.log.clear();
+    return 0;
+}
+
+int main()
+{
+    static const TestCase tests[] = {
+        { "glyph cache",        testGlyphCache },
+        { "text color",         testTextColor },
+        { "text color kept",    testTextColorKept },
+        { "base reference",     testBaseReference },
+    };
+    return runTests(tests);
+}
@@ -0,0 +1,133 @@
+/*
+  Copyright (c) 2026 Arduino SA
+  This Source Code Form is subject to the terms of the Mozilla
+  Public License (MPL), v 2.0. You can obtain a copy of the MPL
+  at http://mozilla.org/MPL/2.0/
+*/
+
+// I2C transfers: every transfer size and addressing mode keeps the panel in sync,
+// and a transfer size above the Wire buffer shrinks to it
+
+#include "Arduino_ST7315_Driver.h"
+#include "BusMonitor.h"
+#include "test.h"
+
+static int runFrames(Arduino_ST7315_Addressing mode, size_t transferSize, size_t wireBuffer, bool diff)
+{
+    Wire1.bufferLength = wireBuffer;
+    Wire1.log.clear();
+
+    Arduino_ST7315_Driver d(128, 64, &Wire1, 0x3D);
+    BusMonitor m;
+
+    CHECK(d.begin());
+    m.feed(Wire1);
+    d.setTransferSize(transferSize);
+    d.setAddressing(mode);
+    if (diff) {
+        CHECK(d.setDiffUpdate(true));
+    }
+
+    srand(12);
+    for (int it = 0; it < 1500; it++) {
+        const int op = rand() % 3;
+        if (op == 0) {
+            d.set(rand() % 128, rand() % 64, rand() % 2);
+        } else if (op == 1) {
+            d.fillRect(rand() % 140 - 6, rand() % 70 - 3, rand() % 30, rand() % 30, rand() % 2);
+        } else if (rand() % 10 == 0) {
+            d.scrollVertical(rand() % 9 - 4);
+        }
+
+        if (rand() % 4 == 0) {
+            if (rand() % 2) {
+                d.update();
+            } else {
+                d.beginUpdate();
+                while (d.poll(rand() % 50)) {
+                }
+            }
+            for (const TwoWire::Transaction &t : Wire1.log) {
+                CHECK(t.bytes.size() <= wireBuffer);
+            }
+            m.feed(Wire1);
+            CHECK(m.matches(d.framebuffer()));
+        }
+    }
+    CHECK(d.transferSize() <= wireBuffer);
+    return 0;
+}
+
+static const Arduino_ST7315_Addressing modes[] = {
+    ST7315_ADDRESSING_SEPARATE,
+    ST7315_ADDRESSING_CONTINUATION,
+    ST7315_ADDRESSING_REPEATED_START,
+};
+
+static int testTransferSizes()
+{
+    for (Arduino_ST7315_Addressing mode : modes) {
+        for (size_t size : { 8, 13, 14, 32, 64, 255 }) {
+            for (int diff = 0; diff < 2; diff++) {
+                CHECK(runFrames(mode, size, 255, diff) == 0);
+            }
+        }
+    }
+    return 0;
+}
+
+// 32- and 48-byte Wire buffers behind a 255-byte transfer size
+static int testProbing()
+{
+    for (bool lies : { false, true }) {
+        Wire1.bulkWriteLies = lies;
+        for (Arduino_ST7315_Addressing mode : modes) {
+            for (size_t buffer : { 32, 48 }) {
+                for (int diff = 0; diff < 2; diff++) {
+                    CHECK(runFrames(mode, 255, buffer, diff) == 0);
+                }
+            }
+        }
+    }
+    Wire1.bulkWriteLies = false;
+    Wire1.bufferLength  = BUFFER_LENGTH;
+    return 0;
+}
+
+// Repeated STARTs and continuation both beat separate transactions on scattered updates
+static int testAddressingCost()
+{
+    uint32_t micros[3];
+    for (int i = 0; i < 3; i++) {
+        Wire1.bufferLength = 255;
+        Arduino_ST7315_Driver d(128, 64, &Wire1, 0x3D);
+        BusMonitor m;
+
+        CHECK(d.begin());
+        d.setTransferSize(255);
+        d.setAddressing(modes[i]);
+        m.feed(Wire1);
+        m.reset();
+        for (int k = 0; k < 16; k++) {
+            d.set(k * 8, k * 4, true);
+        }
+        d.update();
+        m.feed(Wire1);
+        CHECK(m.matches(d.framebuffer()));
+        CHECK((m.repeatedStarts() > 0) == (modes[i] == ST7315_ADDRESSING_REPEATED_START));
+        micros[i] = m.busMicros(400000);
+    }
+    Wire1.bufferLength = BUFFER_LENGTH;
+    CHECK(micros[2] < micros[0]);
+    return 0;
+}
+
+int main()
+{
+    static const TestCase tests[] = {
+        { "transfer sizes",     testTransferSizes },
+        { "transfer probing",   testProbing },
+        { "addressing cost",    testAddressingCost },
+    };
+    return runTests(tests);
+}
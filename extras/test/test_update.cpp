@@ -0,0 +1,338 @@
+/*
+  Copyright (c) 2026 Arduino SA
+  This Source Code Form is subject to the terms of the Mozilla
+  Public License (MPL), v 2.0. You can obtain a copy of the MPL
+  at http://mozilla.org/MPL/2.0/
+*/
+
+// update(): dirty windows, diff flush, start line scrolling, DriverT and page bands
+// all leave the panel GDDRAM equal to the drawing
+
+#include "Arduino_ST7315_Driver.h"
+#include "BusMonitor.h"
+#include "test.h"
+
+static void randomPixels(Arduino_ST7315_Driver &d, Frame &ref, int n)
+{
+    for (int k = 0; k < n; k++) {
+        const int  x  = rand() % 130 - 1;
+        const int  y  = rand() % 66 - 1;
+        const bool on = rand() % 2;
+        d.set(x, y, on);
+        ref.set(x, y, on);
+    }
+}
+
+static int testDirtyWindows()
+{
+    Arduino_ST7315_Driver d(128, 64, &Wire1, 0x3D);
+    BusMonitor m;
+    Frame ref;
+
+    CHECK(d.begin());
+    m.feed(Wire1);
+    CHECK(m.matches(ref.data()));
+
+    srand(1);
+    for (int it = 0; it < 500; it++) {
+        randomPixels(d, ref, rand() % 40);
+        if (rand() % 50 == 0) {
+            d.clear();
+            ref.fill(false);
+        }
+        d.update();
+        m.feed(Wire1);
+        CHECK(m.matches(ref.data()));
+    }
+
+    // A single pixel sends its column only, addressing included
+    m.reset();
+    d.set(5, 5, true);
+    d.update();
+    m.feed(Wire1);
+    CHECK(m.bytes() < 16);
+
+    // Nothing changed, nothing sent
+    m.reset();
+    d.update();
+    m.feed(Wire1);
+    CHECK(m.bytes() == 0);
+    return 0;
+}
+
+static int testDiffUpdate()
+{
+    Arduino_ST7315_Driver d(128, 64, &Wire1, 0x3D);
+    BusMonitor m;
+    Frame ref;
+
+    CHECK(d.begin());
+    m.feed(Wire1);
+    CHECK(d.setDiffUpdate(true));
+
+    srand(2);
+    for (int it = 0; it < 800; it++) {
+        randomPixels(d, ref, rand() % 40);
+        if (rand() % 50 == 0) {
+            d.clear();
+            ref.fill(false);
+        }
+        if (rand() % 70 == 0) {
+            d.invalidate();
+        }
+        d.update();
+        m.feed(Wire1);
+        CHECK(m.matches(ref.data()));
+    }
+
+    // Drawing over unchanged pixels costs nothing with the shadow buffer
+    d.fillRect(0, 0, 10, 8, true);
+    d.update();
+    m.feed(Wire1);
+    d.fillRect(0, 0, 10, 8, false);
+    d.fillRect(0, 0, 10, 8, true);
+    d.update();
+    CHECK(d.lastUpdateBytes() == 0);
+
+    // A clock digit and a progress bar step: both far cheaper than a full frame
+    for (int y = 0; y < 8; y++) {
+        d.set(2, y, !d.get(2, y));
+    }
+    for (int x = 0; x < 3; x++) {
+        d.set(100 + x, 60, !d.get(100 + x, 60));
+    }
+    d.update();
+    m.feed(Wire1);
+    CHECK(d.lastUpdateBytes() < 40);
+    CHECK(d.lastUpdateSaved() > 1000);
+    return 0;
+}
+
+static int testStartLine()
+{
+    Arduino_ST7315_Driver d(128, 64, &Wire1, 0x3D);
+    BusMonitor m;
+    Frame ref;
+
+    CHECK(d.begin());
+    m.feed(Wire1);
+
+    srand(9);
+    for (int it = 0; it < 4000; it++) {
+        const int op = rand() % 4;
+        if (op == 0) {
+            randomPixels(d, ref, 1);
+        } else if (op == 1) {
+            const int  x = rand() % 140 - 6, y = rand() % 76 - 6, w = rand() % 30, h = rand() % 30;
+            const bool on = rand() % 2;
+            d.fillRect(x, y, w, h, on);
+            for (int j = y; j < y + h; j++) {
+                for (int i = x; i < x + w; i++) {
+                    ref.set(i, j, on);
+                }
+            }
+        } else if (op == 2) {
+            const int w = rand() % 20 + 1, h = rand() % 20 + 1, x = rand() % 150 - 10, y = rand() % 84 - 10;
+            std::vector<uint8_t> img(w * ((h + 7) / 8));
+            for (uint8_t &b : img) {
+                b = rand();
+            }
+            d.blit(img.data(), x, y, w, h, ST7315_BITMAP_PAGES, ST7315_OP_XOR);
+            for (int j = 0; j < h; j++) {
+                for (int i = 0; i < w; i++) {
+                    const int X = x + i, Y = y + j;
+                    if (X >= 0 && Y >= 0 && X < 128 && Y < 64) {
+                        ref.set(X, Y, ref.get(X, Y) ^ ((img[(j / 8) * w + i] >> (j & 7)) & 1));
+                    }
+                }
+            }
+        } else {
+            // Rows scrolled out come back on the other side filled with the background
+            const int  dy = rand() % 11 - 5;
+            const bool on = rand() % 2;
+            d.scrollVertical(dy, on);
+            Frame next;
+            for (int y = 0; y < 64; y++) {
+                for (int x = 0; x < 128; x++) {
+                    const int sy = y + dy;
+                    next.set(x, y, (sy >= 0 && sy < 64) ? ref.get(x, sy) : on);
+                }
+            }
+            ref = next;
+        }
+
+        if (rand() % 3 == 0) {
+            d.update();
+            m.feed(Wire1);
+            for (int y = 0; y < 64; y++) {
+                for (int x = 0; x < 128; x++) {
+                    CHECK(m.visible(x, y) == ref.get(x, y));
+                }
+            }
+        }
+    }
+
+    // No GDDRAM write while the controller scrolls, a full refresh after it stops
+    d.startScrollRight(0, 7);
+    m.feed(Wire1);
+    m.reset();
+    d.set(3, 3, true);
+    d.update();
+    m.feed(Wire1);
+    CHECK(m.bytes() == 0);
+    d.stopScroll();
+    d.update();
+    m.feed(Wire1);
+    CHECK(m.bytes() > 1024);
+    return 0;
+}
+
+static int testDriverT()
+{
+    Arduino_ST7315_DriverT<128, 64> t(&Wire1);
+    Arduino_ST7315_Driver d(128, 64, &Wire, 0x3D);
+    BusMonitor mt, md;
+
+    // Drivers destroyed by the previous tests switched their panel off
+    Wire.log.clear();
+    Wire1.log.clear();
+
+    CHECK(t.begin());
+    CHECK(d.begin());
+    CHECK(Wire1.log[0].bytes == Wire.log[0].bytes);     // Same init sequence
+    mt.feed(Wire1);
+    md.feed(Wire);
+
+    srand(8);
+    for (int i = 0; i < 2000; i++) {
+        const int  x  = rand() % 140 - 5, y = rand() % 70 - 3;
+        const bool on = rand() % 2;
+        t.set(x, y, on);
+        d.set(x, y, on);
+    }
+    t.fillRect(3, 5, 40, 20, true);
+    d.fillRect(3, 5, 40, 20, true);
+    t.update();
+    d.update();
+    mt.feed(Wire1);
+    md.feed(Wire);
+    CHECK(memcmp(mt.gddram(), md.gddram(), 1024) == 0);
+    CHECK(mt.matches(t.framebuffer()));
+
+    Arduino_ST7315_DriverT<128, 32> t32(&Wire1);
+    BusMonitor m32(128, 32);
+    CHECK(t32.begin());
+    m32.feed(Wire1);
+    CHECK(m32.matches(t32.framebuffer()));
+    return 0;
+}
+
+// Band rendering produces the same panel content as the full framebuffer
+static int bandSeed;
+static Arduino_ST7315_Driver *bandTarget;
+static uint8_t bandLogo[60 * 8];
+
+static void bandScene()
+{
+    srand(bandSeed);
+    for (int i = 0; i < 60; i++) {
+        const int op = rand() % 3;
+        if (op == 0) {
+            bandTarget->set(rand() % 128, rand() % 64, rand() % 2);
+        } else if (op == 1) {
+            bandTarget->fillRect(rand() % 140 - 6, rand() % 70 - 3, rand() % 40, rand() % 40, rand() % 2);
+        } else {
+            const int x = rand() % 140 - 10, y = rand() % 80 - 10, h = 1 + rand() % 60;
+            const Arduino_ST7315_BitmapLayout layout = (Arduino_ST7315_BitmapLayout)(rand() % 2);
+            bandTarget->blit(bandLogo, x, y, 60, h, layout, (Arduino_ST7315_RasterOp)(rand() % 5));
+        }
+    }
+}
+
+static int testBands()
+{
+    for (uint8_t &b : bandLogo) {
+        b = rand();
+    }
+
+    for (int pages : { 1, 2, 3, 5, 8 }) {
+        for (int startLine : { 0, 13 }) {
+            Arduino_ST7315_Driver full(128, 64, &Wire, 0x3D), band(128, 64, &Wire1, 0x3D);
+            BusMonitor mf, mb;
+
+            CHECK(band.setBandPages(pages));
+            CHECK(pages == 8 || !band.setDiffUpdate(true));
+            CHECK(full.begin());
+            CHECK(band.begin());
+            mf.feed(Wire);
+            mb.feed(Wire1);
+            if (startLine) {
+                full.setStartLine(startLine);
+                band.setStartLine(startLine);
+            }
+
+            for (bandSeed = 1; bandSeed < 30; bandSeed++) {
+                bandTarget = &full;
+                full.drawBands(bandScene);
+                bandTarget = &band;
+                band.drawBands(bandScene);
+                mf.feed(Wire);
+                mb.feed(Wire1);
+                CHECK(memcmp(mf.gddram(), mb.gddram(), 1024) == 0);
+                CHECK(mf.startLine() == mb.startLine());
+            }
+
+            // Picture loop
+            int bands = 0;
+            band.firstBand();
+            do {
+                bands++;
+            } while (band.nextBand());
+            CHECK(bands == (8 + pages - 1) / pages);
+
+            // Back to a full framebuffer
+            CHECK(band.setBandPages(0));
+            bandSeed   = 99;
+            bandTarget = &band;
+            band.drawBands(bandScene);
+            bandTarget = &full;
+            full.drawBands(bandScene);
+            mf.feed(Wire);
+            mb.feed(Wire1);
+            CHECK(memcmp(mf.gddram(), mb.gddram(), 1024) == 0);
+            CHECK(mb.matches(band.framebuffer()));
+        }
+    }
+    return 0;
+}
+
+// Geometries beyond the GDDRAM are refused, and the driver stays unusable
+static int testGeometry()
+{
+    const int bad[][2] = { { 128, 128 }, { 129, 64 }, { 128, 60 }, { 128, 0 }, { 0, 64 } };
+    for (const auto &size : bad) {
+        Arduino_ST7315_Driver d(size[0], size[1], &Wire, 0x3D);
+        CHECK(!d.begin());
+        d.set(5, 70, true);
+        d.fillRect(0, 0, size[0], size[1], true);
+        d.update();
+    }
+
+    Arduino_ST7315_Driver d(64, 48, &Wire, 0x3D);
+    CHECK(d.begin());
+    Wire.log.clear();
+    return 0;
+}
+
+int main()
+{
+    static const TestCase tests[] = {
+        { "dirty windows",      testDirtyWindows },
+        { "diff update",        testDiffUpdate },
+        { "start line",         testStartLine },
+        { "DriverT",            testDriverT },
+        { "page bands",         testBands },
+        { "geometry",           testGeometry },
+    };
+    return runTests(tests);
+}
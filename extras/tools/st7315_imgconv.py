@@ -0,0 +1,185 @@
+#!/usr/bin/env python3
+#
+#  Copyright (c) 2026 Arduino SA
+#  This Source Code Form is subject to the terms of the Mozilla
+#  Public License (MPL), v 2.0. You can obtain a copy of the MPL
+#  at http://mozilla.org/MPL/2.0/
+#
+"""Convert RGB565 image headers into packed 1bpp bitmaps for Arduino_ST7315.
+
+The input is a C header holding an RGB565 byte array, as produced by
+https://lvgl.io/tools/imageconverter and used by ArduinoGraphics image().
+Pixels are thresholded exactly like Arduino_ST7315::set(): a pixel is on
+when (r | g | b) > 127 after expanding the 5/6/5-bit channels to 8 bits.
+
+The output is a C header with a bitmap for Arduino_ST7315_Driver::blit(),
+either in the native page-major layout (default) or row-major. With --rle,
+the page-major bitmap is run-length encoded for Arduino_ST7315_Driver::blitRLE():
+width and height bytes, then runs. A control byte c < 0x80 is followed by
+c + 1 literal bytes, c >= 0x80 by one byte repeated c - 0x7E times.
+
+Example:
+    st7315_imgconv.py img_arduinologobw.h --width 60 --height 60 \\
+        --name img_arduinologobw_1bpp -o img_arduinologobw_1bpp.h
+    st7315_imgconv.py img_arduinologobw.h --width 60 --height 60 --rle \\
+        --name img_arduinologobw_rle -o img_arduinologobw_rle.h
+"""
+
+import argparse
+import re
+import sys
+
+
+def read_rgb565(path, width, height, big_endian):
+    text = open(path).read()
+    # Skip comments, then take every hex byte inside the first array initializer
+    text = re.sub(r'/\*.*?\*/', '', text, flags=re.S)
+    text = re.sub(r'//[^\n]*', '', text)
+    body = text[text.index('{') + 1:text.index('}')]
+    data = [int(v, 16) for v in re.findall(r'0x([0-9a-fA-F]{1,2})', body)]
+
+    if len(data) != width * height * 2:
+        sys.exit('expected %d bytes for a %dx%d RGB565 image, found %d'
+                 % (width * height * 2, width, height, len(data)))
+
+    pixels = []
+    for i in range(0, len(data), 2):
+        lo, hi = (data[i + 1], data[i]) if big_endian else (data[i], data[i + 1])
+        c = (hi << 8) | lo
+        r = ((c >> 11) & 0x1F) << 3
+        g = ((c >> 5) & 0x3F) << 2
+        b = (c & 0x1F) << 3
+        pixels.append((r | g | b) > 127)
+    return pixels
+
+
+def pack_pages(pixels, width, height):
+    out = []
+    for page in range((height + 7) // 8):
+        for x in range(width):
+            byte = 0
+            for bit in range(8):
+                y = page * 8 + bit
+                if y < height and pixels[y * width + x]:
+                    byte |= 1 << bit
+            out.append(byte)
+    return out
+
+
+def pack_rows(pixels, width, height):
+    out = []
+    for y in range(height):
+        for xb in range(0, width, 8):
+            byte = 0
+            for bit in range(8):
+                x = xb + bit
+                if x < width and pixels[y * width + x]:
+                    byte |= 0x80 >> bit
+            out.append(byte)
+    return out
+
+
+def encode_rle(data, width, height):
+    out = [width, height]
+    literal = []
+
+    def flush_literal():
+        for i in range(0, len(literal), 128):
+            chunk = literal[i:i + 128]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+        del literal[:]
+
+    i = 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and run < 129 and data[i + run] == data[i]:
+            run += 1
+        # A run of 2 inside literals costs as much as the literals themselves
+        if run >= 3 or (run == 2 and not literal):
+            flush_literal()
+            out.extend([0x7E + run, data[i]])
+            i += run
+        else:
+            literal.append(data[i])
+            i += 1
+    flush_literal()
+    return out
+
+
+def decode_rle(stream):
+    width, height = stream[0], stream[1]
+    total = width * ((height + 7) // 8)
+    out = []
+    i = 2
+    while len(out) < total:
+        c = stream[i]
+        if c < 0x80:
+            out.extend(stream[i + 1:i + 2 + c])
+            i += 2 + c
+        else:
+            out.extend([stream[i + 1]] * (c - 0x7E))
+            i += 2
+    return out
+
+
+def write_header(out, name, data, width, height, layout, source):
+    guard = '_%s_H' % name.upper()
+    out.write('/**\n')
+    out.write(' * @file %s.h\n' % name)
+    if layout == 'rle':
+        out.write(' * @brief %dx%d RLE compressed 1bpp image for Arduino_ST7315_Driver::blitRLE()\n' % (width, height))
+    else:
+        out.write(' * @brief %dx%d 1bpp bitmap for Arduino_ST7315_Driver::blit()\n' % (width, height))
+    out.write(' *\n')
+    out.write(' * Generated by extras/tools/st7315_imgconv.py from %s\n' % source)
+    out.write(' *\n')
+    if layout == 'rle':
+        out.write(' * @note Page-major bitmap of %d bytes, run-length encoded\n' % (width * ((height + 7) // 8)))
+    else:
+        out.write(' * @note Layout: %s\n' % ('ST7315_BITMAP_PAGES' if layout == 'pages' else 'ST7315_BITMAP_ROWS'))
+    out.write(' * @note Array size: %d bytes\n' % len(data))
+    out.write(' */\n\n')
+    out.write('#ifndef %s\n#define %s\n\n' % (guard, guard))
+    out.write('#include <stdint.h>\n\n')
+    out.write('#define %s_width  %d\n' % (name, width))
+    out.write('#define %s_height %d\n\n' % (name, height))
+    out.write('const uint8_t %s[] = {\n' % name)
+    for i in range(0, len(data), 16):
+        out.write('  ' + ', '.join('0x%02x' % v for v in data[i:i + 16]) + ',\n')
+    out.write('};\n\n')
+    out.write('#endif // %s\n' % guard)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('input', help='C header with an RGB565 byte array')
+    parser.add_argument('--width', type=int, required=True)
+    parser.add_argument('--height', type=int, required=True)
+    parser.add_argument('--name', required=True, help='C identifier of the output array')
+    parser.add_argument('--layout', choices=['pages', 'rows'], default='pages')
+    parser.add_argument('--rle', action='store_true', help='run-length encode the page-major bitmap for blitRLE()')
+    parser.add_argument('--big-endian', action='store_true', help='RGB565 pixels stored high byte first')
+    parser.add_argument('-o', '--output', help='output header (default: stdout)')
+    args = parser.parse_args()
+
+    if args.rle and (args.width > 255 or args.height > 255):
+        sys.exit('RLE images are up to 255x255 pixels')
+
+    pixels = read_rgb565(args.input, args.width, args.height, args.big_endian)
+    layout = args.layout
+    if args.rle:
+        data = encode_rle(pack_pages(pixels, args.width, args.height), args.width, args.height)
+        assert decode_rle(data) == pack_pages(pixels, args.width, args.height)
+        layout = 'rle'
+    elif args.layout == 'pages':
+        data = pack_pages(pixels, args.width, args.height)
+    else:
+        data = pack_rows(pixels, args.width, args.height)
+
+    out = open(args.output, 'w') if args.output else sys.stdout
+    write_header(out, args.name, data, args.width, args.height, layout, args.input.split('/')[-1])
+
+
+if __name__ == '__main__':
+    main()
@@ -7,10 +7,65 @@
 
 #include "Arduino_ST7315.h"
 
-Arduino_ST7315::Arduino_ST7315(int width, int height, TwoWire *wire, uint8_t address)
-    : ArduinoGraphics(width, height),
-      _driver(width, height, wire, address)
+// Simple thresholding for monochrome
+static inline bool isOn(uint8_t r, uint8_t g, uint8_t b)
 {
+    return (r | g | b) > 127;
+}
+
+// Quarter turns need a panel width multiple of 8 (see Arduino_ST7315_Driver::setRotation()):
+// otherwise the display is not rotated, and the drawing surface is sized to match
+static inline Arduino_ST7315_Rotation validRotation(int width, Arduino_ST7315_Rotation rotation)
+{
+    return ((rotation & 1) && (width % 8)) ? ST7315_ROTATION_0 : rotation;
+}
+
+Arduino_ST7315::Arduino_ST7315(int width, int height, TwoWire *wire, uint8_t address, Arduino_ST7315_Rotation rotation)
+    : ArduinoGraphics((validRotation(width, rotation) & 1) ? height : width,
+                      (validRotation(width, rotation) & 1) ? width : height),
+      _driver(width, height, wire, address),
+      _asyncUpdate(false),
+      _probing(false),
+      _colorsSynced(false),
+      _glyphCache(nullptr),
+      _glyphCacheSize(ST7315_GLYPH_CACHE_SIZE),
+      _hardwareTextScroll(false),
+      _textY(0),
+      _textScrollSpeed(150)
+{
+    _driver.setRotation(validRotation(width, rotation));
+
+    // Start from a known drawing state
+    background(0, 0, 0);
+    stroke(255, 255, 255);
+    noFill();
+}
+
+Arduino_ST7315::Arduino_ST7315(int width, int height, Arduino_ST7315_Bus *bus, Arduino_ST7315_Rotation rotation)
+    : ArduinoGraphics((validRotation(width, rotation) & 1) ? height : width,
+                      (validRotation(width, rotation) & 1) ? width : height),
+      _driver(width, height, bus),
+      _asyncUpdate(false),
+      _probing(false),
+      _colorsSynced(false),
+      _glyphCache(nullptr),
+      _glyphCacheSize(ST7315_GLYPH_CACHE_SIZE),
+      _hardwareTextScroll(false),
+      _textY(0),
+      _textScrollSpeed(150)
+{
+    _driver.setRotation(validRotation(width, rotation));
+
+    background(0, 0, 0);
+    stroke(255, 255, 255);
+    noFill();
+}
+
+Arduino_ST7315::~Arduino_ST7315()
+{
+    if (_glyphCache) {
+        free(_glyphCache);
+    }
 }
 
 int Arduino_ST7315::begin()
@@ -25,11 +80,271 @@ void Arduino_ST7315::end()
 
 void Arduino_ST7315::endDraw()
 {
-    _driver.update();
+    _driver.renderEnd();
+
+    if (_asyncUpdate) {
+        _driver.beginUpdate();
+    } else {
+        _driver.update();
+    }
 }
 
 void Arduino_ST7315::set(int x, int y, uint8_t r, uint8_t g, uint8_t b)
 {
-    bool on = (r | g | b) > 127; // Simple thresholding for monochrome
-    _driver.set(x, y, on);
+    if (_probing) {
+        if (x == 0 && y == 0) {
+            _strokeEnabled = true;
+            _strokeOn      = isOn(r, g, b);
+        } else if (x == 1 && y == 2) {
+            _fillEnabled = true;
+            _fillOn      = isOn(r, g, b);
+        } else if (x == 0 && y == 4) {
+            _backgroundOn = isOn(r, g, b);
+        }
+        return;
+    }
+
+    _driver.set(x, y, isOn(r, g, b));
+}
+
+void Arduino_ST7315::syncColors()
+{
+    static const uint8_t clearRow = 0x00;
+
+    _probing       = true;
+    _strokeEnabled = false;
+    _fillEnabled   = false;
+
+    ArduinoGraphics::point(0, 0);                   // Stroke at 0,0
+    ArduinoGraphics::rect(0, 1, 3, 3);              // Fill inside the stroke, at 1,2
+
+    // Background at 0,4: bitmap() only draws with the stroke enabled
+    if (_strokeEnabled) {
+        ArduinoGraphics::bitmap(&clearRow, 0, 4, 1, 1);
+    } else {
+        ArduinoGraphics::stroke(0, 0, 0);
+        ArduinoGraphics::bitmap(&clearRow, 0, 4, 1, 1);
+        ArduinoGraphics::noStroke();
+    }
+
+    _probing = false;
+}
+
+void Arduino_ST7315::bitmap(const uint8_t *data, int x, int y, int width, int height, uint8_t scale_x, uint8_t scale_y)
+{
+    if (!_colorsSynced) {
+        syncColors();
+    }
+    if (!_strokeEnabled || !data || !scale_x || !scale_y || width <= 0 || height <= 0) {
+        return;
+    }
+
+    // Rows are one byte wide as in ArduinoGraphics; scaled glyphs must fit a 64-bit column
+    if (width > 8 || height > 16 || height * scale_y > 64) {
+        ArduinoGraphics::bitmap(data, x, y, width, height, scale_x, scale_y);
+        return;
+    }
+
+    // Set bits take the stroke color, clear bits the background color
+    if (_strokeOn == _backgroundOn) {
+        _driver.fillRect(x, y, width * scale_x, height * scale_y, _strokeOn);
+        return;
+    }
+    const Arduino_ST7315_RasterOp op = _strokeOn ? ST7315_OP_COPY : ST7315_OP_NOT;
+    const uint8_t *cols = glyph(data, width, height);
+
+    // Page-aligned baselines become byte copies, others a two-page shift-merge
+    if (scale_x == 1 && scale_y == 1) {
+        _driver.blit(cols, x, y, width, height, ST7315_BITMAP_PAGES, op);
+        return;
+    }
+
+    // Scaled: stretch each column vertically, then draw it scale_x times
+    const int pages = (height + 7) / 8;
+    for (int i = 0; i < width; i++) {
+        uint16_t src = cols[i];
+        if (pages > 1) {
+            src |= cols[width + i] << 8;
+        }
+
+        uint64_t column = 0;
+        for (int j = 0; j < height; j++) {
+            if (src & (1 << j)) {
+                column |= (~0ULL >> (64 - scale_y)) << (j * scale_y);
+            }
+        }
+
+        uint8_t scaled[8];
+        for (int p = 0; p < 8; p++) {
+            scaled[p] = uint8_t(column >> (8 * p));
+        }
+        for (int xs = 0; xs < scale_x; xs++) {
+            _driver.blit(scaled, x + i * scale_x + xs, y, 1, height * scale_y, ST7315_BITMAP_PAGES, op);
+        }
+    }
+}
+
+void Arduino_ST7315::text(const char *str, int x, int y)
+{
+    // The colors cannot change between the glyphs of a string
+    syncColors();
+    _colorsSynced = true;
+    ArduinoGraphics::text(str, x, y);
+    _colorsSynced = false;
+}
+
+void Arduino_ST7315::setGlyphCacheSize(uint8_t glyphs)
+{
+    if (_glyphCache) {
+        free(_glyphCache);
+        _glyphCache = nullptr;
+    }
+    _glyphCacheSize = glyphs;
+}
+
+void Arduino_ST7315::clearGlyphCache()
+{
+    if (_glyphCache) {
+        memset(_glyphCache, 0, _glyphCacheSize * sizeof(Glyph));
+    }
+}
+
+const uint8_t *Arduino_ST7315::glyph(const uint8_t *data, int width, int height)
+{
+    static uint8_t uncached[16];
+
+    if (!_glyphCache && _glyphCacheSize) {
+        _glyphCache = (Glyph *)calloc(_glyphCacheSize, sizeof(Glyph));
+    }
+
+    // Direct-mapped: glyphs of a font are consecutive and land in different slots
+    Glyph *g = _glyphCache ? &_glyphCache[(uintptr_t)data % _glyphCacheSize] : nullptr;
+    if (g && g->data == data && g->width == width && g->height == height) {
+        return g->cols;
+    }
+
+    uint8_t *cols = g ? g->cols : uncached;
+    memset(cols, 0, 16);
+    for (int j = 0; j < height; j++) {
+        const uint8_t row = data[j];
+        for (int i = 0; i < width; i++) {
+            if (row & (0x80 >> i)) {
+                cols[(j / 8) * width + i] |= 1 << (j & 7);
+            }
+        }
+    }
+
+    if (g) {
+        g->data   = data;
+        g->width  = width;
+        g->height = height;
+    }
+    return cols;
+}
+
+int Arduino_ST7315::setRotation(Arduino_ST7315_Rotation rotation)
+{
+    if ((rotation & 1) != (_driver.rotation() & 1)) {
+        return 0;
+    }
+    return _driver.setRotation(rotation);
+}
+
+void Arduino_ST7315::clear()
+{
+    syncColors();
+    _driver.fillScreen(_backgroundOn);
+}
+
+void Arduino_ST7315::scrollVertical(int dy)
+{
+    syncColors();
+    _driver.scrollVertical(dy, _backgroundOn);
+}
+
+void Arduino_ST7315::beginText(int x, int y)
+{
+    ArduinoGraphics::beginText(x, y);
+    _textY = y;
+}
+
+void Arduino_ST7315::beginText(int x, int y, uint8_t r, uint8_t g, uint8_t b)
+{
+    ArduinoGraphics::beginText(x, y, r, g, b);
+    _textY = y;
+}
+
+void Arduino_ST7315::beginText(int x, int y, uint32_t color)
+{
+    ArduinoGraphics::beginText(x, y, color);
+    _textY = y;
+}
+
+void Arduino_ST7315::textScrollSpeed(unsigned long speed)
+{
+    ArduinoGraphics::textScrollSpeed(speed);
+    _textScrollSpeed = speed;
+}
+
+void Arduino_ST7315::endText(int scroll)
+{
+    if (!_hardwareTextScroll || (scroll != SCROLL_UP && scroll != SCROLL_DOWN)) {
+        ArduinoGraphics::endText(scroll);
+        return;
+    }
+
+    // Draw the text once, then move the view one row per step until it is gone
+    ArduinoGraphics::endText(NO_SCROLL);
+    syncColors();
+
+    const int dy    = (scroll == SCROLL_UP) ? 1 : -1;
+    const int steps = (scroll == SCROLL_UP) ? _textY + textFontHeight() : height() - _textY;
+    for (int i = 0; i < steps; i++) {
+        beginDraw();
+        _driver.scrollVertical(dy, _backgroundOn);
+        endDraw();
+        delay(_textScrollSpeed);
+    }
+}
+
+void Arduino_ST7315::line(int x1, int y1, int x2, int y2)
+{
+    // Axis-aligned lines are spans, everything else goes through Bresenham
+    if (x1 != x2 && y1 != y2) {
+        ArduinoGraphics::line(x1, y1, x2, y2);
+        return;
+    }
+
+    syncColors();
+    if (!_strokeEnabled) {
+        return;
+    }
+    if (x1 == x2) {
+        _driver.drawVLine(x1, min(y1, y2), abs(y2 - y1) + 1, _strokeOn);
+    } else {
+        _driver.drawHLine(min(x1, x2), y1, abs(x2 - x1) + 1, _strokeOn);
+    }
+}
+
+void Arduino_ST7315::rect(int x, int y, int width, int height)
+{
+    if (width <= 0 || height <= 0) {
+        return;
+    }
+
+    syncColors();
+    if (_fillEnabled) {
+        if (_strokeEnabled) {
+            _driver.fillRect(x + 1, y + 1, width - 2, height - 2, _fillOn);
+        } else {
+            _driver.fillRect(x, y, width, height, _fillOn);
+        }
+    }
+
+    if (_strokeEnabled) {
+        _driver.drawHLine(x, y, width, _strokeOn);
+        _driver.drawHLine(x, y + height - 1, width, _strokeOn);
+        _driver.drawVLine(x, y, height, _strokeOn);
+        _driver.drawVLine(x + width - 1, y, height, _strokeOn);
+    }
 }
@@ -18,24 +18,145 @@
 class Arduino_ST7315 : public ArduinoGraphics
 {
 public:
+    // width and height are the panel geometry: rotated by 90 or 270 degrees,
+    // the drawing surface is height x width. Those rotations need a width multiple
+    // of 8, the display is left unrotated otherwise (see rotation()).
     Arduino_ST7315(
         int width = 128,
         int height = 64,
         TwoWire *wire = &Wire1,
-        uint8_t address = 0x3D
+        uint8_t address = 0x3D,
+        Arduino_ST7315_Rotation rotation = ST7315_ROTATION_0
     );
 
-    ~Arduino_ST7315() {}
+    // Any other transport, e.g. Arduino_ST7315_SPIBus
+    Arduino_ST7315(int width, int height, Arduino_ST7315_Bus *bus,
+                   Arduino_ST7315_Rotation rotation = ST7315_ROTATION_0);
+
+    ~Arduino_ST7315();
 
     int begin() override;
     void end() override;
 
-    void beginDraw() override {}
+    void beginDraw() override { _driver.renderBegin(); }
     void endDraw() override;
 
     void set(int x, int y, uint8_t r, uint8_t g, uint8_t b) override;
+
+    // Fast paths: these draw with the driver bulk primitives instead of one
+    // virtual set() call per pixel, in the colors set on ArduinoGraphics.
+    // clear() is not virtual there: through an ArduinoGraphics reference, the
+    // generic version runs.
+    void clear();
+    void line(int x1, int y1, int x2, int y2) override;
+    void rect(int x, int y, int width, int height) override;
+
+    // Text and 1bpp row bitmaps (glyphs, up to 8x16): every bitmap is transposed
+    // into the panel page layout and drawn by the driver blit engine. With a glyph
+    // cache (off by default, about 24 bytes of heap per glyph) a bitmap is only
+    // transposed once, keyed by its data pointer. Cached bitmaps are assumed
+    // constant, as font data is: call clearGlyphCache() after changing one in RAM.
+    void bitmap(const uint8_t *data, int x, int y, int width, int height, uint8_t scale_x = 1, uint8_t scale_y = 1) override;
+    void setGlyphCacheSize(uint8_t glyphs);
+    void clearGlyphCache();
+    using ArduinoGraphics::text;
+    void text(const char *str, int x = 0, int y = 0) override;
+
+    // Text scrolling: with hardware text scroll enabled, SCROLL_UP and SCROLL_DOWN
+    // move the whole screen through the display start line instead of redrawing
+    // the text at every step, so each step only sends the row coming into view.
+    void beginText(int x = 0, int y = 0) override;
+    void beginText(int x, int y, uint8_t r, uint8_t g, uint8_t b) override;
+    void beginText(int x, int y, uint32_t color) override;
+    void endText(int scroll = NO_SCROLL) override;
+    void textScrollSpeed(unsigned long speed = 150) override;
+    void setHardwareTextScroll(bool enable) { _hardwareTextScroll = enable; }
+
+    // Rotation, see Arduino_ST7315_Driver. The drawing surface size is set by the
+    // constructor: at runtime, only rotations with the same width and height apply.
+    int setRotation(Arduino_ST7315_Rotation rotation);
+    Arduino_ST7315_Rotation rotation() const { return _driver.rotation(); }
+
+    // Controller scrolling, see Arduino_ST7315_Driver
+    void startScrollRight(uint8_t page0, uint8_t page1, uint8_t interval = ST7315_SCROLL_5FRAMES) { _driver.startScrollRight(page0, page1, interval); }
+    void startScrollLeft(uint8_t page0, uint8_t page1, uint8_t interval = ST7315_SCROLL_5FRAMES) { _driver.startScrollLeft(page0, page1, interval); }
+    void stopScroll() { _driver.stopScroll(); }
+    void scrollVertical(int dy);
+
+    // Runtime statistics and trace hooks, see Arduino_ST7315_Driver
+    const Arduino_ST7315_Stats &stats() const { return _driver.stats(); }
+    void resetStats() { _driver.resetStats(); }
+    void setTraceHook(void (*hook)(Arduino_ST7315_Event event)) { _driver.setTraceHook(hook); }
+
+    // Raw framebuffer in GDDRAM order, see Arduino_ST7315_Driver
+    const uint8_t *framebuffer() const { return _driver.framebuffer(); }
+
+    // I2C transfer tuning, see Arduino_ST7315_Driver
+    void setTransferSize(size_t bytes) { _driver.setTransferSize(bytes); }
+    size_t transferSize() const { return _driver.transferSize(); }
+    void setAddressing(Arduino_ST7315_Addressing mode) { _driver.setAddressing(mode); }
+
+    // Page-band rendering for low-RAM boards, see Arduino_ST7315_Driver.
+    // Call setBandPages() before begin(), then draw every frame with drawBands()
+    // or the firstBand()/nextBand() loop instead of beginDraw()/endDraw().
+    int setBandPages(uint8_t pages) { return _driver.setBandPages(pages); }
+    void firstBand() { _driver.firstBand(); }
+    bool nextBand() { return _driver.nextBand(); }
+    void drawBands(void (*draw)()) { _driver.drawBands(draw); }
+
+    // Packed and RLE compressed 1bpp bitmaps, drawn by the driver blit engine (see extras/tools/st7315_imgconv.py)
+    void blit(const uint8_t *data, int x, int y, int w, int h,
+              Arduino_ST7315_BitmapLayout layout = ST7315_BITMAP_PAGES,
+              Arduino_ST7315_RasterOp op = ST7315_OP_COPY) { _driver.blit(data, x, y, w, h, layout, op); }
+    void blitRLE(const uint8_t *data, int x, int y,
+                 Arduino_ST7315_RasterOp op = ST7315_OP_COPY) { _driver.blitRLE(data, x, y, op); }
+
+    // Sprites moved over the drawn background and pixel read-back, see Arduino_ST7315_Driver
+    int addSprite(const uint8_t *data, int w, int h,
+                  Arduino_ST7315_SpriteMode mode = ST7315_SPRITE_XOR,
+                  Arduino_ST7315_BitmapLayout layout = ST7315_BITMAP_PAGES) { return _driver.addSprite(data, w, h, mode, layout); }
+    void moveSprite(int id, int x, int y) { _driver.moveSprite(id, x, y); }
+    void hideSprite(int id) { _driver.hideSprite(id); }
+    void removeSprite(int id) { _driver.removeSprite(id); }
+    bool get(int x, int y) const { return _driver.get(x, y); }
+
+    // Non-blocking flush: when enabled, endDraw() only starts the transfer
+    // and the sketch calls poll() from loop() until isBusy() returns false.
+    void setAsyncUpdate(bool enable) { _asyncUpdate = enable; }
+    bool poll(size_t maxBytes = 0, unsigned long maxMicros = 0) { return _driver.poll(maxBytes, maxMicros); }
+    bool isBusy() const { return _driver.isBusy(); }
+    void onUpdateComplete(void (*callback)()) { _driver.onUpdateComplete(callback); }
 protected:
     Arduino_ST7315_Driver _driver; // Low-level driver instance
+    bool _asyncUpdate;             // endDraw() starts a non-blocking flush
+
+    // ArduinoGraphics keeps its colors private and sets them without virtual
+    // calls: syncColors() reads them back before a fast path draws, by letting
+    // the generic code draw a few probe pixels that set() records instead
+    void syncColors();
+
+    bool _probing;                 // set() records the probe pixels
+    bool _colorsSynced;            // Read once per text() for all its glyphs
+    bool _strokeEnabled;           // Monochrome copy of the ArduinoGraphics drawing state
+    bool _strokeOn;
+    bool _fillEnabled;
+    bool _fillOn;
+    bool _backgroundOn;
+
+    struct Glyph {
+        const uint8_t *data;       // Source rows, nullptr for a free slot
+        uint8_t width;
+        uint8_t height;
+        uint8_t cols[16];          // Page layout, up to 2 pages of 8 columns
+    };
+    const uint8_t *glyph(const uint8_t *data, int width, int height);
+
+    Glyph *_glyphCache;            // Allocated on the first bitmap() call
+    uint8_t _glyphCacheSize;       // Glyphs in the cache, 0 for none
+
+    bool _hardwareTextScroll;      // Vertical text scrolling through the display start line
+    int _textY;                    // Copy of the ArduinoGraphics text position and speed
+    unsigned long _textScrollSpeed;
 };
 
 #endif // _ARDUINO_ST7315_H
\ No newline at end of file
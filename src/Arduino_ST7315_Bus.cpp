@@ -0,0 +1,147 @@
+/*
+  Copyright (c) 2026 Arduino SA
+  This Source Code Form is subject to the terms of the Mozilla
+  Public License (MPL), v 2.0. You can obtain a copy of the MPL
+  at http://mozilla.org/MPL/2.0/
+*/
+
+#include "Arduino_ST7315_Bus.h"
+
+// Determine Wire library max buffer size, the default transfer size
+#if defined(ARDUINO_ARCH_MBED)      // e.g., Nano 33 BLE, Portenta, GIGA: 256-byte TX buffer
+    #define WIRE_MAX_BUF_LEN 255
+#elif defined(I2C_BUFFER_LENGTH)    // e.g, Renesas and ESP32 Wire Lib
+    #define WIRE_MAX_BUF_LEN min(255, I2C_BUFFER_LENGTH)
+#elif defined(BUFFER_LENGTH)        // e.g., AVR Wire Lib
+    #define WIRE_MAX_BUF_LEN min(255, BUFFER_LENGTH)
+#elif defined(SERIAL_BUFFER_SIZE)   // e.g., SAMD Wire Lib uses RingBuffer
+    #define WIRE_MAX_BUF_LEN min(255, SERIAL_BUFFER_SIZE - 1)
+#else
+    #define WIRE_MAX_BUF_LEN 32     // If not defined, assume 32 bytes (conservative default)
+#endif
+
+// Bytes copied per SPI transfer(buf, len) call, which overwrites its buffer
+#define ST7315_SPI_CHUNK           32
+
+Arduino_ST7315_I2CBus::Arduino_ST7315_I2CBus(TwoWire *wire, uint8_t address)
+    : _wire(wire)
+    , _address(address)
+    , _txLen(0)
+    , _verified(0)
+{
+}
+
+int Arduino_ST7315_I2CBus::begin()
+{
+    _wire->begin();
+    return 1;
+}
+
+void Arduino_ST7315_I2CBus::beginTransfer(uint8_t mode)
+{
+    _wire->beginTransmission(_address);
+    _txLen = _wire->write(mode);
+}
+
+size_t Arduino_ST7315_I2CBus::write(const uint8_t *data, size_t n)
+{
+    // Some cores (AVR) return n from write(data, n) even when their buffer overflows,
+    // but refuse single bytes reliably: beyond the transaction length already
+    // accepted, write byte by byte so that a short buffer is noticed
+    if (_txLen + n <= _verified) {
+        _txLen += n;
+        return _wire->write(data, n);
+    }
+
+    size_t written = 0;
+    while (written < n && _wire->write(data[written])) {
+        written++;
+    }
+    _txLen   += written;
+    _verified = max(_verified, _txLen);
+    return written;
+}
+
+uint8_t Arduino_ST7315_I2CBus::endTransfer(bool stop)
+{
+    return _wire->endTransmission(stop);
+}
+
+size_t Arduino_ST7315_I2CBus::transferSize() const
+{
+    return WIRE_MAX_BUF_LEN;
+}
+
+Arduino_ST7315_SPIBus::Arduino_ST7315_SPIBus(SPIClass *spi, int csPin, int dcPin, int rstPin, uint32_t clock)
+    : _spi(spi)
+    , _csPin(csPin)
+    , _dcPin(dcPin)
+    , _rstPin(rstPin)
+    , _settings(clock, MSBFIRST, SPI_MODE0)
+    , _frameDepth(0)
+{
+}
+
+int Arduino_ST7315_SPIBus::begin()
+{
+    pinMode(_csPin, OUTPUT);
+    digitalWrite(_csPin, HIGH);
+    pinMode(_dcPin, OUTPUT);
+
+    // Hardware reset: RES# low for at least 3 us, then wait for the controller
+    if (_rstPin >= 0) {
+        pinMode(_rstPin, OUTPUT);
+        digitalWrite(_rstPin, HIGH);
+        delay(1);
+        digitalWrite(_rstPin, LOW);
+        delay(10);
+        digitalWrite(_rstPin, HIGH);
+        delay(10);
+    }
+
+    _spi->begin();
+    return 1;
+}
+
+void Arduino_ST7315_SPIBus::beginFrame()
+{
+    if (_frameDepth++ == 0) {
+        _spi->beginTransaction(_settings);
+    }
+}
+
+void Arduino_ST7315_SPIBus::endFrame()
+{
+    if (_frameDepth > 0 && --_frameDepth == 0) {
+        _spi->endTransaction();
+    }
+}
+
+void Arduino_ST7315_SPIBus::beginTransfer(uint8_t mode)
+{
+    // Transfers outside a frame claim the bus on their own
+    beginFrame();
+    digitalWrite(_dcPin, (mode & ST7315_MODE_DATA) ? HIGH : LOW);
+    digitalWrite(_csPin, LOW);
+}
+
+size_t Arduino_ST7315_SPIBus::write(const uint8_t *data, size_t n)
+{
+    uint8_t buf[ST7315_SPI_CHUNK];
+
+    for (size_t sent = 0; sent < n; ) {
+        const size_t len = min<size_t>(n - sent, sizeof(buf));
+        memcpy(buf, &data[sent], len);
+        _spi->transfer(buf, len);
+        sent += len;
+    }
+    return n;
+}
+
+uint8_t Arduino_ST7315_SPIBus::endTransfer(bool stop)
+{
+    (void)stop;
+    digitalWrite(_csPin, HIGH);
+    endFrame();
+    return 0;
+}
@@ -0,0 +1,105 @@
+/*
+  Copyright (c) 2026 Arduino SA
+  This Source Code Form is subject to the terms of the Mozilla
+  Public License (MPL), v 2.0. You can obtain a copy of the MPL
+  at http://mozilla.org/MPL/2.0/
+*/
+
+#ifndef _ARDUINO_ST7315_BUS_H
+#define _ARDUINO_ST7315_BUS_H
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <SPI.h>
+
+// ST7315 transfer modes: I2C control byte, SPI D/C pin level
+#define ST7315_MODE_COMMAND        0x00 // DC = 0
+#define ST7315_MODE_DATA           0x40 // DC = 1
+#define ST7315_MODE_CONTINUATION   0x80 // Co = 1, a single byte follows, then another control byte (I2C only)
+
+#define ST7315_SPI_CLOCK           8000000      // The controller accepts up to 10 MHz
+#define ST7315_SPI_TRANSFER_SIZE   (1 + 1024)   // A whole 128x64 frame in one chip select burst
+
+// @class Arduino_ST7315_Bus
+// @brief Transport between Arduino_ST7315_Driver and the controller.
+// A transfer is one I2C transaction or one chip select burst, carrying either
+// commands or GDDRAM data. Implement this interface to drive the panel
+// over another transport.
+
+class Arduino_ST7315_Bus
+{
+public:
+    virtual ~Arduino_ST7315_Bus() {}
+
+    virtual int begin() = 0;
+
+    // Brackets a batch of transfers, e.g. a frame: SPI claims the bus only once
+    virtual void beginFrame() {}
+    virtual void endFrame() {}
+
+    virtual void beginTransfer(uint8_t mode) = 0;                 // ST7315_MODE_COMMAND or ST7315_MODE_DATA
+    virtual size_t write(const uint8_t *data, size_t n) = 0;      // Returns the bytes accepted
+    virtual uint8_t endTransfer(bool stop = true) = 0;            // Returns 0 on success; stop = false for a repeated START
+
+    virtual size_t transferSize() const = 0;                      // Default bytes per transfer, mode byte included
+    virtual size_t maxTransferSize() const { return transferSize(); }
+    virtual bool controlBytes() const { return false; }           // The mode travels in-band as an I2C control byte
+};
+
+// @class Arduino_ST7315_I2CBus
+// @inherits Arduino_ST7315_Bus
+// @brief I2C transport over TwoWire, the default of Arduino_ST7315_Driver.
+
+class Arduino_ST7315_I2CBus : public Arduino_ST7315_Bus
+{
+public:
+    Arduino_ST7315_I2CBus(TwoWire *wire = &Wire1, uint8_t address = 0x3D);
+
+    int begin() override;
+
+    void beginTransfer(uint8_t mode) override;
+    size_t write(const uint8_t *data, size_t n) override;
+    uint8_t endTransfer(bool stop = true) override;
+
+    size_t transferSize() const override;
+    size_t maxTransferSize() const override { return 255; }
+    bool controlBytes() const override { return true; }
+
+private:
+    TwoWire     *_wire;
+    uint8_t     _address;
+    size_t      _txLen;         // Bytes in the current transaction, control byte included
+    size_t      _verified;      // Longest transaction Wire accepted byte by byte
+};
+
+// @class Arduino_ST7315_SPIBus
+// @inherits Arduino_ST7315_Bus
+// @brief 4-wire SPI transport: chip select, data/command and optional reset pins.
+// The SPI bus is claimed with a single beginTransaction() per frame.
+
+class Arduino_ST7315_SPIBus : public Arduino_ST7315_Bus
+{
+public:
+    Arduino_ST7315_SPIBus(SPIClass *spi, int csPin, int dcPin, int rstPin = -1, uint32_t clock = ST7315_SPI_CLOCK);
+
+    int begin() override;   // Also resets the controller when the reset pin is wired
+
+    void beginFrame() override;
+    void endFrame() override;
+
+    void beginTransfer(uint8_t mode) override;
+    size_t write(const uint8_t *data, size_t n) override;
+    uint8_t endTransfer(bool stop = true) override;
+
+    size_t transferSize() const override { return ST7315_SPI_TRANSFER_SIZE; }
+
+private:
+    SPIClass    *_spi;
+    int         _csPin;
+    int         _dcPin;
+    int         _rstPin;
+    SPISettings _settings;
+    uint8_t     _frameDepth;    // Nested beginFrame() calls, the transaction is open while > 0
+};
+
+#endif // _ARDUINO_ST7315_BUS_H
@@ -0,0 +1,31 @@
+/*
+  Copyright (c) 2026 Arduino SA
+  This Source Code Form is subject to the terms of the Mozilla
+  Public License (MPL), v 2.0. You can obtain a copy of the MPL
+  at http://mozilla.org/MPL/2.0/
+*/
+
+#ifndef _ARDUINO_ST7315_CONFIG_H
+#define _ARDUINO_ST7315_CONFIG_H
+
+// Library build options. The library sources and every sketch must see the same
+// values: change them here or with global build flags (-D...), never with a
+// #define in the sketch before the #include.
+
+// Runtime statistics and trace hooks, only when set to 1 (see Arduino_ST7315_Driver::stats())
+#ifndef ST7315_STATS
+#define ST7315_STATS                0
+#endif
+
+// Sprite slots per driver, see Arduino_ST7315_Driver::addSprite()
+#ifndef ST7315_MAX_SPRITES
+#define ST7315_MAX_SPRITES          4
+#endif
+
+// Glyphs kept by the text cache of Arduino_ST7315 until setGlyphCacheSize()
+// changes it; 0 for no cache and no heap
+#ifndef ST7315_GLYPH_CACHE_SIZE
+#define ST7315_GLYPH_CACHE_SIZE     0
+#endif
+
+#endif // _ARDUINO_ST7315_CONFIG_H
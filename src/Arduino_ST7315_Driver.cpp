@@ -7,97 +7,145 @@
 
 #include "Arduino_ST7315_Driver.h"
 
-// Determine Wire library max buffer size
-#if defined(I2C_BUFFER_LENGTH)      // e.g, Renesas Wire Lib
-    #define WIRE_MAX_BUF_LEN min(255, I2C_BUFFER_LENGTH)
-#elif defined(BUFFER_LENGTH)        // e.g., AVR Wire Lib
-    #define WIRE_MAX_BUF_LEN min(255, BUFFER_LENGTH)
-#elif defined(SERIAL_BUFFER_SIZE)   // e.g., SAMD Wire Lib uses RingBuffer
-    #define WIRE_MAX_BUF_LEN min(255, SERIAL_BUFFER_SIZE - 1)
-#else
-    #define WIRE_MAX_BUF_LEN 32     // If not defined, assume 32 bytes (conservative default)
-#endif
+// Bus cost model used by update(), in byte times on the wire:
+// every transaction pays START + address + STOP + control byte,
+// every window additionally pays a 6-byte column/page addressing sequence.
+#define ST7315_COST_TRANSACTION    2
+#define ST7315_COST_ADDRESSING     (6 + ST7315_COST_TRANSACTION)   // Own transaction
+#define ST7315_COST_ADDRESSING_CO  (2 * 6)                          // A Co control byte per command
+#define ST7315_COST_ADDRESSING_SR  (6 + 1)                          // No STOP and bus free time
 
-// ST7315 Wire mode control bytes
-#define ST7315_MODE_COMMAND        0x00 // DC = 0
-#define ST7315_MODE_DATA           0x40 // DC = 1
-
-// ST7315 Commands
-#define ST7315_DISPLAYOFF          0xAE
-#define ST7315_DISPLAYON           0xAF
-#define ST7315_COLUMNADDR          0x21
-#define ST7315_PAGEADDR            0x22
-#define ST7315_SETDISPLAYCLOCKDIV  0xD5
-#define ST7315_SETMULTIPLEX        0xA8
-#define ST7315_SETDISPLAYOFFSET    0xD3
-#define ST7315_SETSTARTLINE        0x40
-#define ST7315_CHARGEPUMP          0x8D
-#define ST7315_MEMORYMODE          0x20
-#define ST7315_SEGREMAP            0xA1
-#define ST7315_COMSCANDEC          0xC8
-#define ST7315_SETPRECHARGE        0xD9
-#define ST7315_SETVCOMDETECT       0xDB
-#define ST7315_DISPLAYALLON_RESUME 0xA4
-#define ST7315_NORMALDISPLAY       0xA6
-#define ST7315_SET_CONTRAST        0x81
-#define ST7315_SET_COM_PINS        0xDA
-#define SSD1306_DEACTIVATE_SCROLL  0x2E
-#define SSD1306_DISPLAYALLON_RESUME 0xA4
+// Smallest transfer size, keeps the addressing sequence in one transaction.
+// Every Wire library buffers at least 32 bytes, so the addressing is never cut
+// short while the transfer size is still being probed.
+#define ST7315_MIN_TRANSFER_SIZE   8
 
 Arduino_ST7315_Driver::Arduino_ST7315_Driver(int width, int height, TwoWire *wire, uint8_t address)
-    : _width(width)
+    : Arduino_ST7315_Driver(width, height, wire, address, nullptr, nullptr, nullptr, 0)
+{
+}
+
+Arduino_ST7315_Driver::Arduino_ST7315_Driver(int width, int height, Arduino_ST7315_Bus *bus)
+    : Arduino_ST7315_Driver(width, height, nullptr, 0, bus, nullptr, nullptr, 0)
+{
+}
+
+Arduino_ST7315_Driver::Arduino_ST7315_Driver(int width, int height, TwoWire *wire, uint8_t address, Arduino_ST7315_Bus *bus,
+                                             uint8_t *buffer, const uint8_t *initCmds, uint8_t initLen)
+    : _startLine(0)
+    , _rotation(ST7315_ROTATION_0)
+    , _width(width)
     , _height(height)
-    , _wire(wire)
-    , _address(address)
-    , _buffer(nullptr)
+    , _panelWidth(width)
+    , _panelHeight(height)
+    , _i2c(wire, address)
+    , _bus(bus ? bus : &_i2c)
+    , _buffer(buffer)
+    , _staticBuffer(buffer != nullptr)
+    , _bandPages(0)
+    , _bandPage0(0)
+    , _bandPageEnd(height / 8)
+    , _initCmds(initCmds)
+    , _initLen(initLen)
+    , _shadow(nullptr)
+    , _shadowValid(false)
+    , _busBytes(0)
+    , _transferSize(0)                      // Bus default, read in begin()
+    , _txBytes(0)
+    , _addressing(ST7315_ADDRESSING_SEPARATE)
+    , _lastUpdateBytes(0)
+    , _lastUpdateSaved(0)
+    , _passBusBytes(0)
+    , _busy(false)
+    , _updatePending(false)
+    , _onUpdateComplete(nullptr)
+    , _planCount(0)
+    , _planIndex(0)
+    , _planDiff(false)
+    , _scanPage(0)
+    , _scanX(0)
+    , _winActive(false)
+    , _winPage(0)
+    , _winCol(0)
+    , _scrolling(false)
+    , _startLinePending(false)
+    , _remapPending(false)
 {
+    memset(_dirtyX0, 0xFF, sizeof(_dirtyX0));
+    memset(_dirtyX1, 0x00, sizeof(_dirtyX1));
+    memset(_sprites, 0, sizeof(_sprites));
+
+#if ST7315_STATS
+    _traceHook  = nullptr;
+    _passMicros = 0;
+    resetStats();
+#endif
 }
 
 Arduino_ST7315_Driver::~Arduino_ST7315_Driver()
 {
-    if (_buffer) {
+    if (_buffer && !_staticBuffer) {
         free(_buffer);
     }
+    if (_shadow) {
+        free(_shadow);
+    }
+    for (int id = 0; id < ST7315_MAX_SPRITES; id++) {
+        if (_sprites[id].saved) {
+            free(_sprites[id].saved);
+        }
+    }
 
     end();
 }
 
 int Arduino_ST7315_Driver::begin()
 {
-    size_t bufferSize = (_width * _height) / 8;
+    // Same limits as the static_asserts of Arduino_ST7315_DriverT: the dirty
+    // column tracking holds one entry per GDDRAM page
+    if (_panelWidth <= 0 || _panelWidth > 128 ||
+        _panelHeight < 8 || _panelHeight > ST7315_MAX_PAGES * 8 || (_panelHeight % 8) != 0) {
+        return 0;
+    }
 
-    _buffer = (uint8_t *)malloc(bufferSize);
     if (!_buffer) {
-        return 0;
+        _buffer = (uint8_t *)malloc(_width * (_bandPageEnd - _bandPage0));
+        if (!_buffer) {
+            return 0;
+        }
     }
     clear();
 
-    _wire->begin();
-
-    // Init sequence
-    const uint8_t initCmds[] = {
-        ST7315_DISPLAYOFF,                  // 0xAE: Display OFF during setup
-        ST7315_SETDISPLAYCLOCKDIV, 0x80,    // 0xD5 0x80: Set display clock divide ratio / oscillator frequency
-        ST7315_SETMULTIPLEX, (uint8_t)(_height-1),  // 0xA8 0x3F: Multiplex ratio = (Display height - 1)
-        ST7315_SETDISPLAYOFFSET, 0x00,      // 0xD3 0x00: Display offset = 0 (no vertical shift)
-        ST7315_SETSTARTLINE | 0x00,         // 0x40: Set display start line at 0
-        ST7315_CHARGEPUMP, 0x14,            // 0x8D 0x14: Enable charge pump (internal DC-DC 0x14 / external 0x10)
-        ST7315_MEMORYMODE, 0x00,            // 0x20 0x00: Set memory addressing mode to page addressing
-        ST7315_SEGREMAP,                    // 0xA1: Segment remap (flip horizontal direction)
-        ST7315_COMSCANDEC,                  // 0xC8: COM output scan direction = remapped (flip vertical direction)
-        ST7315_SET_COM_PINS, 0x12,          // 0xDA 0x12: COM pins hardware configuration (FIXME: only for 128x64)
-        ST7315_SET_CONTRAST, 0x7F,          // 0x81 0x7F: Set contrast (FIXME: may need adjustment according to voltage supply and display size)
-        ST7315_SETPRECHARGE, 0xF1,          // 0xD9 0xF1: Set pre-charge period for stable pixel voltage (FIXME: may need adjustment according to voltage supply)
-        ST7315_SETVCOMDETECT, 0x20,         // 0xDB 0x20: Set VCOMH deselect level (for contrast stabilization)
-        SSD1306_DISPLAYALLON_RESUME,        // 0xA4: Resume to RAM content display
-        ST7315_NORMALDISPLAY,               // 0xA6: Set normal display mode (not inverted)
-        SSD1306_DEACTIVATE_SCROLL           // 0x2E: Deactivate scroll if previously enabled
-    };
-    commandList(initCmds, sizeof(initCmds));
+    if (!_bus->begin()) {
+        return 0;
+    }
+    if (!_transferSize) {
+        _transferSize = _bus->transferSize();
+    }
+
+    // Init sequence: compile-time table for Arduino_ST7315_DriverT, built from the geometry otherwise
+    _bus->beginFrame();
+    if (_initCmds) {
+        commandList(_initCmds, _initLen);
+    } else {
+        const uint8_t initCmds[] = { ST7315_INIT_SEQUENCE(_panelHeight) };
+        commandList(initCmds, sizeof(initCmds));
+    }
+    if (_rotation & 2) {
+        command(ST7315_SEGREMAP_OFF);
+        command(ST7315_COMSCANINC);
+    }
+    _remapPending = false;
     // Turn display ON as the last step to avoid glitches
     command(ST7315_DISPLAYON);              // 0xAF: Display ON (after all setup commands)
+    _bus->endFrame();
 
-    update(); // Initial display update to clear screen
+    invalidate(); // GDDRAM content is undefined at power-up
+    if (_bandPages) {
+        drawBands(nullptr);
+    } else {
+        update(); // Initial display update to clear screen
+    }
 
     return 1;
 }
@@ -107,6 +155,47 @@ void Arduino_ST7315_Driver::end()
     command(ST7315_DISPLAYOFF);
 }
 
+int Arduino_ST7315_Driver::setRotation(Arduino_ST7315_Rotation rotation)
+{
+    const bool quarter = rotation & 1;
+    if (quarter && (_bandPages || (_panelWidth % 8))) {
+        return 0;
+    }
+
+    // The framebuffer layout is in use until the current flush completes
+    while (poll(SIZE_MAX)) {
+    }
+    if (quarter) {
+        setDiffUpdate(false);
+        if (_startLine) {
+            _startLine        = 0;
+            _startLinePending = true;
+        }
+    }
+
+    // Half turns only flip the controller scan directions
+    if ((rotation & 2) != (_rotation & 2)) {
+        _remapPending = true;
+    }
+
+    const bool changed = quarter != bool(_rotation & 1);
+    _rotation = rotation;
+
+    // Quarter turns swap the drawing surface and change the framebuffer layout
+    if (changed) {
+        _width       = quarter ? _panelHeight : _panelWidth;
+        _height      = quarter ? _panelWidth : _panelHeight;
+        _bandPageEnd = _height / 8;
+        memset(_dirtyX0, 0xFF, sizeof(_dirtyX0));
+        memset(_dirtyX1, 0x00, sizeof(_dirtyX1));
+        if (_buffer) {
+            fillScreen(false);
+            invalidate();
+        }
+    }
+    return 1;
+}
+
 void Arduino_ST7315_Driver::set(int x, int y, bool on)
 {
     if (!_buffer) {
@@ -116,78 +205,1241 @@ void Arduino_ST7315_Driver::set(int x, int y, bool on)
         return;
     }
 
-    uint16_t index = x + (y / 8) * _width;
+    // Logical rows are stored shifted by the display start line
+    y += _startLine;
+    if (y >= _height) {
+        y -= _height;
+    }
+
+    // Page-band mode: only the rows of the current band are kept
+    const int page = y / 8;
+    if (page < _bandPage0 || page >= _bandPageEnd) {
+        return;
+    }
+
+    uint16_t index = x + (page - _bandPage0) * _width;
     uint8_t  bit  = 1 << (y & 7);
+    uint8_t  old  = _buffer[index];
+
+#if ST7315_STATS
+    _stats.pixels++;
+#endif
 
     if (on) {
         _buffer[index] |= bit;
     } else {
         _buffer[index] &= ~bit;
     }
+
+    if (_buffer[index] != old) {
+        markDirty(page, x, x);
+    }
+}
+
+bool Arduino_ST7315_Driver::get(int x, int y) const
+{
+    if (!_buffer || x < 0 || y < 0 || x >= _width || y >= _height) {
+        return false;
+    }
+
+    y += _startLine;
+    if (y >= _height) {
+        y -= _height;
+    }
+
+    const int page = y / 8;
+    if (page < _bandPage0 || page >= _bandPageEnd) {
+        return false;
+    }
+    return _buffer[x + (page - _bandPage0) * _width] & (1 << (y & 7));
 }
 
 void Arduino_ST7315_Driver::clear()
 {
+    fillScreen(false);
+}
+
+void Arduino_ST7315_Driver::fillRect(int x, int y, int w, int h, bool on)
+{
+    if (!_buffer) {
+        return;
+    }
+
+    // Clip rows to the screen, then map them to GDDRAM rows through the start line
+    const int y0    = max(y, 0);
+    const int y1    = min(y + h, _height);
+    const int split = _height - _startLine;     // First row that wraps to the top of GDDRAM
+
+    if (y0 < split && y0 < y1) {
+        fillRectPhys(x, y0 + _startLine, w, min(y1, split) - y0, on);
+    }
+    if (y1 > split) {
+        fillRectPhys(x, max(y0, split) - split, w, y1 - max(y0, split), on);
+    }
+}
+
+void Arduino_ST7315_Driver::fillRectPhys(int x, int y, int w, int h, bool on)
+{
+    // Clip columns, rows are already within the screen and only need clipping to the band
+    int x0 = max(x, 0);
+    int x1 = min(x + w, _width) - 1;
+    int y1 = min(y + h, _bandPageEnd * 8) - 1;
+    y      = max(y, _bandPage0 * 8);
+    if (x0 > x1 || y > y1) {
+        return;
+    }
+
+#if ST7315_STATS
+    _stats.pixels += (x1 - x0 + 1) * (y1 - y + 1);
+#endif
+
+    const int page0 = y / 8;
+    const int page1 = y1 / 8;
+
+    for (int page = page0; page <= page1; page++) {
+        uint8_t mask = 0xFF;
+        if (page == page0) {
+            mask &= 0xFF << (y & 7);
+        }
+        if (page == page1) {
+            mask &= 0xFF >> (7 - (y1 & 7));
+        }
+
+        // Only the columns that actually change are marked dirty
+        uint8_t *row = &_buffer[(page - _bandPage0) * _width];
+        int first    = x1 + 1;
+        int last     = x0 - 1;
+
+        if (mask == 0xFF) {
+            const uint8_t value = on ? 0xFF : 0x00;
+            first = x0;
+            last  = x1;
+            while (first <= last && row[first] == value) first++;
+            while (last >= first && row[last] == value) last--;
+            if (first <= last) {
+                memset(&row[first], value, last - first + 1);
+            }
+        } else {
+            for (int i = x0; i <= x1; i++) {
+                const uint8_t value = on ? (row[i] | mask) : (row[i] & ~mask);
+                if (value != row[i]) {
+                    row[i] = value;
+                    first  = min(first, i);
+                    last   = i;
+                }
+            }
+        }
+
+        if (first <= last) {
+            markDirty(page, first, last);
+        }
+    }
+}
+
+// Transpose an 8x8 block of row-major bits (MSB on the left) into
+// 8 page-major column bytes (LSB on top), a 64-bit word at a time.
+static void transpose8(const uint8_t rows[8], uint8_t cols[8])
+{
+    uint64_t x = 0;
+    for (int i = 0; i < 8; i++) {
+        x |= (uint64_t)rows[i] << (8 * i);
+    }
+
+    uint64_t t;
+    t = (x ^ (x >> 7))  & 0x00AA00AA00AA00AAULL; x ^= t ^ (t << 7);
+    t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCCULL; x ^= t ^ (t << 14);
+    t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0ULL; x ^= t ^ (t << 28);
+
+    // Byte j now holds source bit j of every row, bit 7 is the leftmost column
+    for (int i = 0; i < 8; i++) {
+        cols[i] = uint8_t(x >> (8 * (7 - i)));
+    }
+}
+
+// Combine masked source bits into a framebuffer byte
+static inline uint8_t rasterOp(uint8_t dst, uint8_t src, uint8_t mask, Arduino_ST7315_RasterOp op)
+{
+    switch (op) {
+    case ST7315_OP_OR:  return dst | (src & mask);
+    case ST7315_OP_AND: return dst & (src | ~mask);
+    case ST7315_OP_XOR: return dst ^ (src & mask);
+    case ST7315_OP_NOT: return (dst & ~mask) | (~src & mask);
+    default:            return (dst & ~mask) | (src & mask);
+    }
+}
+
+// Mask of the bits of a page that fall within rows [y0, y1)
+static inline uint8_t rowMask(int page, int y0, int y1)
+{
+    const int a = max(y0 - page * 8, 0);
+    const int b = min(y1 - page * 8, 8);
+    return (a < b) ? uint8_t((0xFF << a) & (0xFF >> (8 - b))) : 0;
+}
+
+void Arduino_ST7315_Driver::blit(const uint8_t *data, int x, int y, int w, int h,
+                                 Arduino_ST7315_BitmapLayout layout, Arduino_ST7315_RasterOp op)
+{
+    if (!_buffer || !data || w <= 0 || h <= 0) {
+        return;
+    }
+
+    // Visible rows, mapped to GDDRAM rows through the start line like fillRect()
+    const int y0    = max(y, 0);
+    const int y1    = min(y + h, _height);
+    const int split = _height - _startLine;
+
+    if (y0 < split && y0 < y1) {
+        blitPhys(data, x, y + _startLine, w, h, layout, op, y0 + _startLine, min(y1, split) + _startLine);
+    }
+    if (y1 > split) {
+        blitPhys(data, x, y - split, w, h, layout, op, max(y0, split) - split, y1 - split);
+    }
+}
+
+void Arduino_ST7315_Driver::blitPhys(const uint8_t *data, int x, int y, int w, int h,
+                                     Arduino_ST7315_BitmapLayout layout, Arduino_ST7315_RasterOp op,
+                                     int clipY0, int clipY1)
+{
+    // Clip columns, rows are clipped to [clipY0, clipY1) per destination page below
+    const int i0 = max(0, -x);
+    const int i1 = min(w, _width - x) - 1;
+    if (i0 > i1) {
+        return;
+    }
+
+    // Page-band mode: rows outside the band are dropped
+    clipY0 = max(clipY0, _bandPage0 * 8);
+    clipY1 = min(clipY1, _bandPageEnd * 8);
+
+#if ST7315_STATS
+    _stats.pixels += (i1 - i0 + 1) * max(0, min(clipY1, y + h) - max(clipY0, y));
+#endif
+
+    const int srcPages  = (h + 7) / 8;
+    const int rowStride = (w + 7) / 8;
+    const int shift     = y & 7;                   // Also right for negative y
+    const int basePage  = (y - shift) / 8;         // Page of source row 0, may be negative
+
+    for (int sp = 0; sp < srcPages; sp++) {
+        // A source page lands on one destination page, or straddles two when y is not page-aligned
+        const int dp0 = basePage + sp;
+        const int dp1 = dp0 + 1;
+        const uint8_t mask   = (sp == srcPages - 1 && (h & 7)) ? (0xFF >> (8 - (h & 7))) : 0xFF;
+        const uint8_t maskLo = (dp0 >= _bandPage0 && dp0 < _bandPageEnd) ? uint8_t(mask << shift) & rowMask(dp0, clipY0, clipY1) : 0;
+        const uint8_t maskHi = (shift && dp1 >= _bandPage0 && dp1 < _bandPageEnd) ? uint8_t(mask >> (8 - shift)) & rowMask(dp1, clipY0, clipY1) : 0;
+        if (!maskLo && !maskHi) {
+            continue;
+        }
+
+        uint8_t block[8];
+        int blockIndex = -1;
+
+        for (int i = i0; i <= i1; i++) {
+            uint8_t src;
+            if (layout == ST7315_BITMAP_PAGES) {
+                src = data[sp * w + i];
+            } else {
+                // Convert 8 columns of 8 rows at once
+                if ((i >> 3) != blockIndex) {
+                    uint8_t rows[8];
+                    blockIndex = i >> 3;
+                    for (int r = 0; r < 8; r++) {
+                        const int row = sp * 8 + r;
+                        rows[r] = (row < h) ? data[row * rowStride + blockIndex] : 0;
+                    }
+                    transpose8(rows, block);
+                }
+                src = block[i & 7];
+            }
+
+            uint8_t *dst = &_buffer[x + i - _bandPage0 * _width];
+            if (maskLo) {
+                dst[dp0 * _width] = rasterOp(dst[dp0 * _width], src << shift, maskLo, op);
+            }
+            if (maskHi) {
+                dst[dp1 * _width] = rasterOp(dst[dp1 * _width], src >> (8 - shift), maskHi, op);
+            }
+        }
+
+        if (maskLo) {
+            markDirty(dp0, x + i0, x + i1);
+        }
+        if (maskHi) {
+            markDirty(dp1, x + i0, x + i1);
+        }
+    }
+}
+
+void Arduino_ST7315_Driver::blitRLE(const uint8_t *data, int x, int y, Arduino_ST7315_RasterOp op)
+{
+    if (!_buffer || !data || !data[0] || !data[1]) {
+        return;
+    }
+
+    const int w        = data[0];
+    const int h        = data[1];
+    const size_t total = w * ((h + 7) / 8);
+    data += 2;
+
+    // Each run is drawn as one or more blits of up to a page row: literal runs
+    // straight from the stream, repeated bytes from a small buffer
+    uint8_t repeat[16];
+    size_t pos = 0;
+    while (pos < total) {
+        const uint8_t c     = *data++;
+        const bool literal  = c < 0x80;
+        size_t n            = literal ? c + 1 : c - 0x7E;
+        if (!literal) {
+            memset(repeat, *data++, sizeof(repeat));
+        }
+
+        while (n > 0 && pos < total) {
+            const int page = pos / w;
+            const int col  = pos % w;
+            size_t len     = min(n, (size_t)(w - col));
+            if (!literal) {
+                len = min(len, sizeof(repeat));
+            }
+
+            blit(literal ? data : repeat, x + col, y + page * 8, len, min(8, h - page * 8), ST7315_BITMAP_PAGES, op);
+            if (literal) {
+                data += len;
+            }
+            pos += len;
+            n   -= len;
+        }
+    }
+}
+
+void Arduino_ST7315_Driver::fillScreen(bool on)
+{
+    if (!_buffer) {
+        return;
+    }
+
+    // Only the columns that actually change need to be sent again
+    const uint8_t value = on ? 0xFF : 0x00;
+    for (int page = _bandPage0; page < _bandPageEnd; page++) {
+        const uint8_t *row = &_buffer[(page - _bandPage0) * _width];
+        int x0 = 0;
+        int x1 = _width - 1;
+
+        while (x0 <= x1 && row[x0] == value) x0++;
+        while (x1 >= x0 && row[x1] == value) x1--;
+
+        if (x0 <= x1) {
+            markDirty(page, x0, x1);
+        }
+    }
+
+    memset(_buffer, value, _width * (_bandPageEnd - _bandPage0));
+
+    // Sprites are wiped with the rest of the screen
+    for (int id = 0; id < ST7315_MAX_SPRITES; id++) {
+        _sprites[id].drawn = false;
+    }
+}
+
+int Arduino_ST7315_Driver::addSprite(const uint8_t *data, int w, int h,
+                                     Arduino_ST7315_SpriteMode mode, Arduino_ST7315_BitmapLayout layout)
+{
+    // Erasing relies on the framebuffer keeping the whole screen
+    if (!data || w <= 0 || h <= 0 || w > _width || h > _height || _bandPages) {
+        return -1;
+    }
+
+    for (int id = 0; id < ST7315_MAX_SPRITES; id++) {
+        Sprite &s = _sprites[id];
+        if (s.data) {
+            continue;
+        }
+
+        s.saved = nullptr;
+        if (mode == ST7315_SPRITE_SAVE_UNDER) {
+            s.saved = (uint8_t *)malloc(w * ((h + 7) / 8));
+            if (!s.saved) {
+                return -1;
+            }
+        }
+        s.data   = data;
+        s.x      = 0;
+        s.y      = 0;
+        s.w      = w;
+        s.h      = h;
+        s.mode   = mode;
+        s.layout = layout;
+        s.drawn  = false;
+        return id;
+    }
+    return -1;
+}
+
+void Arduino_ST7315_Driver::moveSprite(int id, int x, int y)
+{
+    Sprite *s = sprite(id);
+    if (!s || (s->drawn && s->x == x && s->y == y)) {
+        return;
+    }
+
+    eraseSprite(*s);
+    s->x = x;
+    s->y = y;
+    drawSprite(*s);
+}
+
+void Arduino_ST7315_Driver::hideSprite(int id)
+{
+    Sprite *s = sprite(id);
+    if (s) {
+        eraseSprite(*s);
+    }
+}
+
+void Arduino_ST7315_Driver::removeSprite(int id)
+{
+    Sprite *s = sprite(id);
+    if (!s) {
+        return;
+    }
+
+    eraseSprite(*s);
+    if (s->saved) {
+        free(s->saved);
+    }
+    memset(s, 0, sizeof(*s));
+}
+
+bool Arduino_ST7315_Driver::spriteVisible(int id) const
+{
+    return id >= 0 && id < ST7315_MAX_SPRITES && _sprites[id].drawn;
+}
+
+Arduino_ST7315_Driver::Sprite *Arduino_ST7315_Driver::sprite(int id)
+{
+    if (id < 0 || id >= ST7315_MAX_SPRITES || !_sprites[id].data) {
+        return nullptr;
+    }
+    return &_sprites[id];
+}
+
+void Arduino_ST7315_Driver::drawSprite(Sprite &s)
+{
+    if (!_buffer || _bandPages) {
+        return;
+    }
+
+    if (s.mode == ST7315_SPRITE_XOR) {
+        blit(s.data, s.x, s.y, s.w, s.h, s.layout, ST7315_OP_XOR);
+    } else {
+        // Keep the background as a page-major bitmap, restored as is by eraseSprite()
+        memset(s.saved, 0, s.w * ((s.h + 7) / 8));
+        for (int j = 0; j < s.h; j++) {
+            for (int i = 0; i < s.w; i++) {
+                if (get(s.x + i, s.y + j)) {
+                    s.saved[(j / 8) * s.w + i] |= 1 << (j & 7);
+                }
+            }
+        }
+        blit(s.data, s.x, s.y, s.w, s.h, s.layout, ST7315_OP_OR);
+    }
+    s.drawn = true;
+}
+
+void Arduino_ST7315_Driver::eraseSprite(Sprite &s)
+{
+    if (!s.drawn) {
+        return;
+    }
+
+    if (s.mode == ST7315_SPRITE_XOR) {
+        blit(s.data, s.x, s.y, s.w, s.h, s.layout, ST7315_OP_XOR);
+    } else {
+        blit(s.saved, s.x, s.y, s.w, s.h, ST7315_BITMAP_PAGES, ST7315_OP_COPY);
+    }
+    s.drawn = false;
+}
+
+void Arduino_ST7315_Driver::invalidate()
+{
+    for (int page = _bandPage0; page < _bandPageEnd; page++) {
+        markDirty(page, 0, _width - 1);
+    }
+    _shadowValid      = false;
+    _startLinePending = true;
+}
+
+void Arduino_ST7315_Driver::startScrollRight(uint8_t page0, uint8_t page1, uint8_t interval)
+{
+    startScroll(SSD1306_RIGHT_HORIZONTAL_SCROLL, page0, page1, interval, -1);
+}
+
+void Arduino_ST7315_Driver::startScrollLeft(uint8_t page0, uint8_t page1, uint8_t interval)
+{
+    startScroll(SSD1306_LEFT_HORIZONTAL_SCROLL, page0, page1, interval, -1);
+}
+
+void Arduino_ST7315_Driver::startScrollDiagRight(uint8_t page0, uint8_t page1, uint8_t verticalOffset, uint8_t interval)
+{
+    startScroll(SSD1306_VERTICAL_AND_RIGHT_HORIZONTAL_SCROLL, page0, page1, interval, verticalOffset);
+}
+
+void Arduino_ST7315_Driver::startScrollDiagLeft(uint8_t page0, uint8_t page1, uint8_t verticalOffset, uint8_t interval)
+{
+    startScroll(SSD1306_VERTICAL_AND_LEFT_HORIZONTAL_SCROLL, page0, page1, interval, verticalOffset);
+}
+
+void Arduino_ST7315_Driver::startScroll(uint8_t cmd, uint8_t page0, uint8_t page1, uint8_t interval, int verticalOffset)
+{
+    // The scrolled content must be on the panel before GDDRAM gets locked
+    if (_scrolling) {
+        stopScroll();
+    }
+    update();
+
+    if (verticalOffset < 0) {
+        uint8_t cmdList[] = {
+            SSD1306_DEACTIVATE_SCROLL,
+            cmd,
+            0x00,                       // Dummy byte
+            page0,                      // Start page
+            interval,                   // Time interval between scroll steps
+            page1,                      // End page
+            0x00,                       // Dummy byte
+            0xFF,                       // Dummy byte
+            SSD1306_ACTIVATE_SCROLL
+        };
+        commandList(cmdList, sizeof(cmdList));
+    } else {
+        uint8_t cmdList[] = {
+            SSD1306_DEACTIVATE_SCROLL,
+            SSD1306_SET_VERTICAL_SCROLL_AREA,
+            0x00,                       // No fixed rows on top
+            uint8_t(_panelHeight),      // Whole screen scrolls vertically
+            cmd,
+            0x00,                       // Dummy byte
+            page0,                      // Start page
+            interval,                   // Time interval between scroll steps
+            page1,                      // End page
+            uint8_t(verticalOffset),    // Rows per vertical scroll step
+            SSD1306_ACTIVATE_SCROLL
+        };
+        commandList(cmdList, sizeof(cmdList));
+    }
+
+    _scrolling = true;
+}
+
+void Arduino_ST7315_Driver::stopScroll()
+{
+    if (!_scrolling) {
+        return;
+    }
+
+    command(SSD1306_DEACTIVATE_SCROLL);
+    _scrolling = false;
+
+    // GDDRAM content and start line are undefined after a continuous scroll
+    invalidate();
+}
+
+void Arduino_ST7315_Driver::setStartLine(int line)
+{
+    // Panel rows run across the drawing surface when rotated by a quarter turn
+    if (_rotation & 1) {
+        return;
+    }
+
+    line %= _height;
+    if (line < 0) {
+        line += _height;
+    }
+
+    _startLine        = line;
+    _startLinePending = true;
+}
+
+void Arduino_ST7315_Driver::scrollVertical(int dy, bool on)
+{
+    if (_rotation & 1) {
+        return;
+    }
+
+    dy %= _height;
+    if (dy == 0) {
+        return;
+    }
+
+    // The rows scrolled out come back in on the other side: fill them
+    setStartLine(_startLine + dy);
+    if (dy > 0) {
+        fillRect(0, _height - dy, _width, dy, on);
+    } else {
+        fillRect(0, 0, _width, -dy, on);
+    }
+}
+
+int Arduino_ST7315_Driver::setDiffUpdate(bool enable)
+{
+    // The shadow buffer is in use until the current flush completes
+    while (poll(SIZE_MAX)) {
+    }
+
+    // Bands are redrawn from scratch, there is no previous frame to compare against
+    if (enable && (_bandPages || (_rotation & 1))) {
+        return 0;
+    }
+
+    if (!enable) {
+        if (_shadow) {
+            free(_shadow);
+            _shadow = nullptr;
+        }
+        return 1;
+    }
+
+    if (!_shadow) {
+        _shadow = (uint8_t *)malloc((_width * _height) / 8);
+        if (!_shadow) {
+            return 0;
+        }
+        _shadowValid = false;
+    }
+    return 1;
+}
+
+int Arduino_ST7315_Driver::setBandPages(uint8_t pages)
+{
+    if (_staticBuffer || (_rotation & 1)) {
+        return pages == 0;
+    }
+
+    // A band as tall as the screen is the full framebuffer
+    if (pages >= _height / 8) {
+        pages = 0;
+    }
+
+    while (poll(SIZE_MAX)) {
+    }
+
+    // After begin(), swap the buffer for one of the new size. It is allocated
+    // first: on failure the current buffer and mode are kept.
+    const uint8_t pageEnd = pages ? pages : _height / 8;
     if (_buffer) {
-        memset(_buffer, 0, (_width * _height) / 8);
+        uint8_t *buffer = (uint8_t *)malloc(_width * pageEnd);
+        if (!buffer) {
+            return 0;
+        }
+        free(_buffer);
+        _buffer = buffer;
+    }
+
+    if (pages) {
+        setDiffUpdate(false);
     }
+    _bandPages   = pages;
+    _bandPage0   = 0;
+    _bandPageEnd = pageEnd;
+    memset(_dirtyX0, 0xFF, sizeof(_dirtyX0));
+    memset(_dirtyX1, 0x00, sizeof(_dirtyX1));
+
+    if (_buffer) {
+        fillScreen(false);
+        invalidate();
+    }
+    return 1;
+}
+
+void Arduino_ST7315_Driver::firstBand()
+{
+    if (!_buffer) {
+        return;
+    }
+
+    if (!_bandPages) {
+        fillScreen(false);
+        renderBegin();
+        return;
+    }
+
+    _bandPage0   = 0;
+    _bandPageEnd = _bandPages;
+    startBand();
+}
+
+bool Arduino_ST7315_Driver::nextBand()
+{
+    renderEnd();
+    update();
+
+    if (!_bandPages || _bandPageEnd >= _height / 8) {
+        return false;
+    }
+
+    _bandPage0   = _bandPageEnd;
+    _bandPageEnd = min(_bandPage0 + _bandPages, _height / 8);
+    startBand();
+    return true;
+}
+
+void Arduino_ST7315_Driver::drawBands(void (*draw)())
+{
+    firstBand();
+    do {
+        if (draw) {
+            draw();
+        }
+    } while (nextBand());
+}
+
+void Arduino_ST7315_Driver::startBand()
+{
+    // The panel still shows the previous frame here: send the whole band
+    memset(_buffer, 0, _width * (_bandPageEnd - _bandPage0));
+    for (int page = _bandPage0; page < _bandPageEnd; page++) {
+        markDirty(page, 0, _width - 1);
+    }
+    renderBegin();
 }
 
 void Arduino_ST7315_Driver::update()
 {
-    // ST7315 organizes the screen into pages (8 vertical pixels per page) 
-    // and columns (horizontal pixels). Before sending the framebuffer data, 
-    // we need to tell the display which columns and pages we want to update.
-    uint8_t cmdList[] = {
-        ST7315_COLUMNADDR,          
-        0,                          // Column start address
-        uint8_t(_width - 1),        // Column end address
-        ST7315_PAGEADDR,            
-        0,                          // Page start address
-        uint8_t((_height / 8) - 1)  // Page end address
-    };
-    commandList(cmdList, sizeof(cmdList));
+    beginUpdate();
+    while (poll(SIZE_MAX)) {
+        // Blocking flush: drain the whole frame at once
+    }
+}
+
+void Arduino_ST7315_Driver::beginUpdate()
+{
+    if (!_buffer) {
+        return;
+    }
+
+    // GDDRAM is locked while scrolling, dirty areas are kept for later
+    if (_scrolling) {
+        return;
+    }
+
+    // A flush already in flight picks up the new dirty areas once it is done
+    if (_busy) {
+        _updatePending = true;
+        return;
+    }
+
+    startPass();
+}
+
+bool Arduino_ST7315_Driver::poll(size_t maxBytes, unsigned long maxMicros)
+{
+    if (!_busy) {
+        return false;
+    }
+
+    const unsigned long startTime = micros();
+    const size_t busBytes         = _busBytes;
+
+    // A time-only budget has no byte limit
+    if (maxBytes == 0 && maxMicros != 0) {
+        maxBytes = SIZE_MAX;
+    }
+
+    // Always make progress by at least one transaction, then respect the budget.
+    // The bus is claimed once per call, i.e. once per frame for a blocking update().
+    _bus->beginFrame();
+    do {
+        if (!sendChunk()) {
+            finishPass();
+            break;
+        }
+    } while ((_busBytes - busBytes) < maxBytes &&
+             (maxMicros == 0 || (micros() - startTime) < maxMicros));
+
+#if ST7315_STATS
+    // Only the time spent sending counts, not the sketch running between the calls
+    _passMicros += micros() - startTime;
+    if (!_busy) {
+        _stats.frames++;
+        _stats.updateMicrosTotal += _passMicros;
+        _stats.updateMicrosMax    = max<uint32_t>(_stats.updateMicrosMax, _passMicros);
+    }
+#endif
+    _bus->endFrame();
+
+    if (!_busy) {
+        // Only once the bus is released: the callback may well use it
+        // (SPI transactions and bus locks do not nest on every core)
+        if (_onUpdateComplete) {
+            _onUpdateComplete();
+        }
+
+        // Unless the callback already started one, the next pass is sent by the next poll()
+        if (_updatePending) {
+            _updatePending = false;
+            if (!_busy) {
+                startPass();
+            }
+        }
+    }
+
+    return _busy;
+}
+
+void Arduino_ST7315_Driver::startPass()
+{
+#if ST7315_STATS
+    _stats.framePixels = _stats.pixels;
+    _stats.pixels      = 0;
+    _passMicros        = 0;
+#endif
+    trace(ST7315_EVENT_FLUSH_BEGIN);
+
+    _busy         = true;
+    _passBusBytes = _busBytes;
+    _planCount    = 0;
+    _planIndex    = 0;
+    _winActive    = false;
+    _planDiff     = _shadow && _shadowValid;
+
+    if (_planDiff) {
+        // Runs are found lazily while sending, from a snapshot of the dirty columns
+        memcpy(_planX0, _dirtyX0, sizeof(_planX0));
+        memcpy(_planX1, _dirtyX1, sizeof(_planX1));
+        _scanPage = 0;
+        _scanX    = 0;
+    } else {
+        planWindows();
+        if (_shadow) {
+            // Everything outside the planned windows is already in sync,
+            // the windows themselves are copied again as they are sent.
+            memcpy(_shadow, _buffer, (_width * _height) / 8);
+            _shadowValid = true;
+        }
+    }
+
+    // Drawing while the flush is in progress marks areas dirty again for the next pass
+    memset(_dirtyX0, 0xFF, sizeof(_dirtyX0));
+    memset(_dirtyX1, 0x00, sizeof(_dirtyX1));
+}
+
+void Arduino_ST7315_Driver::finishPass()
+{
+    const size_t fullBytes = fullFrameBytes();
+    _lastUpdateBytes = _busBytes - _passBusBytes;
+    _lastUpdateSaved = (_lastUpdateBytes < fullBytes) ? fullBytes - _lastUpdateBytes : 0;
+    _busy            = false;
+
+    trace(ST7315_EVENT_FLUSH_END);
+
+    // Moving the view only once the rows coming into view are written avoids showing stale content
+    if (_startLinePending) {
+        _startLinePending = false;
+        command(ST7315_SETSTARTLINE | _startLine);
+    }
+    if (_remapPending) {
+        _remapPending = false;
+        command((_rotation & 2) ? ST7315_SEGREMAP_OFF : ST7315_SEGREMAP);
+        command((_rotation & 2) ? ST7315_COMSCANINC : ST7315_COMSCANDEC);
+    }
+}
+
+void Arduino_ST7315_Driver::planWindows()
+{
+    // ST7315 organizes the screen into pages (8 vertical pixels per page)
+    // and columns (horizontal pixels). Only the dirty part of each page is sent:
+    // consecutive pages can be grouped into one window spanning the union of their
+    // dirty columns, which saves an addressing sequence but may resend clean bytes.
+    // Pick the cheapest grouping with a small dynamic program over the pages.
+    const int pages = _panelHeight / 8;
+    size_t  best[ST7315_MAX_PAGES + 1];    // Cheapest cost to cover pages [0, j)
+    uint8_t start[ST7315_MAX_PAGES + 1];   // First page of the window ending at page j - 1
+    uint16_t skip = 0;                     // Bit j set: page j - 1 is clean and skipped
+
+    best[0] = 0;
+    for (int j = 1; j <= pages; j++) {
+        best[j]  = SIZE_MAX;
+        start[j] = j - 1;
+
+        if (_dirtyX0[j - 1] > _dirtyX1[j - 1]) {
+            best[j] = best[j - 1];
+            skip   |= (1 << j);
+        }
+
+        int x0 = _panelWidth;
+        int x1 = -1;
+        for (int i = j - 1; i >= 0; i--) {
+            if (_dirtyX0[i] > _dirtyX1[i]) {
+                continue; // A window never needs to start on a clean page
+            }
+            x0 = min<int>(x0, _dirtyX0[i]);
+            x1 = max<int>(x1, _dirtyX1[i]);
+
+            size_t cost = best[i] + windowCost(x0, x1, j - i);
+            if (cost < best[j]) {
+                best[j]  = cost;
+                start[j] = i;
+                skip    &= ~(1 << j);
+            }
+        }
+    }
+
+    for (int j = pages; j > 0; ) {
+        if (skip & (1 << j)) {
+            j--;
+            continue;
+        }
+
+        int i  = start[j];
+        int x0 = _panelWidth;
+        int x1 = -1;
+        for (int p = i; p < j; p++) {
+            if (_dirtyX0[p] <= _dirtyX1[p]) {
+                x0 = min<int>(x0, _dirtyX0[p]);
+                x1 = max<int>(x1, _dirtyX1[p]);
+            }
+        }
+
+        Window &w = _plan[_planCount++];
+        w.x0    = x0;
+        w.x1    = x1;
+        w.page0 = i;
+        w.page1 = j - 1;
+        j = i;
+    }
+}
+
+bool Arduino_ST7315_Driver::nextWindow(Window &w)
+{
+    if (!_planDiff) {
+        if (_planIndex >= _planCount) {
+            return false;
+        }
+        w = _plan[_planIndex++];
+        return true;
+    }
 
-    const size_t bufferSize = _width * (_height / 8);
-    const uint8_t *ptr      = _buffer;
-    size_t remaining        = bufferSize;
+    // Compare the framebuffer against the last frame sent, 32 bits at a time,
+    // restricted to the dirty columns of each page. Changed runs closer than the
+    // cost of a new addressing sequence are merged and sent as a single window.
+    const int maxGap = addressingCost() + ST7315_COST_TRANSACTION;
 
-    const size_t maxPayload = WIRE_MAX_BUF_LEN - 1; // Reserve 1 byte for mode command byte
+    for (; _scanPage < _panelHeight / 8; _scanPage++, _scanX = 0) {
+        if (_planX0[_scanPage] > _planX1[_scanPage]) {
+            continue;
+        }
 
-    while (remaining > 0) {
-        size_t chunkSize = min(remaining, maxPayload);
+        const uint8_t *cur = &_buffer[_scanPage * _width];
+        const uint8_t *old = &_shadow[_scanPage * _width];
+        const int end      = _planX1[_scanPage] + 1;
+        int x              = max<int>(_scanX, _planX0[_scanPage] & ~3);
+        int runX0          = -1;
+        int runX1          = -1;
 
-        _wire->beginTransmission(_address);
-        _wire->write(ST7315_MODE_DATA);
-        _wire->write(ptr, chunkSize);
-        _wire->endTransmission();
+        while (x < end) {
+            if (runX0 >= 0 && (x - runX1 - 1) >= maxGap) {
+                break;
+            }
 
-        ptr       += chunkSize;
-        remaining -= chunkSize;
+            if (x + 4 <= end && ((x & 3) == 0)) {
+                uint32_t a, b;
+                memcpy(&a, &cur[x], sizeof(a));
+                memcpy(&b, &old[x], sizeof(b));
+                if (a == b) {
+                    x += 4;
+                    continue;
+                }
+            }
+
+            if (cur[x] != old[x]) {
+                if (runX0 < 0) {
+                    runX0 = x;
+                }
+                runX1 = x;
+            }
+            x++;
+        }
+
+        if (runX0 >= 0) {
+            _scanX  = runX1 + 1;
+            w.x0    = runX0;
+            w.x1    = runX1;
+            w.page0 = _scanPage;
+            w.page1 = _scanPage;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool Arduino_ST7315_Driver::sendChunk()
+{
+    size_t room = _transferSize - 1;    // Reserve 1 byte for the data control byte
+
+    if (!_winActive) {
+        if (!nextWindow(_win)) {
+            return false;
+        }
+        _winActive = true;
+        _winPage   = _win.page0;
+        _winCol    = 0;
+
+        // Tell the display which columns and pages we are about to write,
+        // in horizontal addressing mode the column pointer wraps to x0 on the next page.
+        const uint8_t cmdList[] = {
+            ST7315_COLUMNADDR,
+            _win.x0,                    // Column start address
+            _win.x1,                    // Column end address
+            ST7315_PAGEADDR,
+            _win.page0,                 // Page start address
+            _win.page1                  // Page end address
+        };
+
+        if (_addressing == ST7315_ADDRESSING_CONTINUATION && _bus->controlBytes() && room > 2 * sizeof(cmdList)) {
+            // One transaction: every command byte behind a Co = 1 control byte, then the data stream
+            const uint8_t cont = ST7315_MODE_CONTINUATION | ST7315_MODE_COMMAND;
+            const uint8_t mode = ST7315_MODE_DATA;
+
+            busBegin(cont);
+            for (size_t i = 0; i < sizeof(cmdList); i++) {
+                if (i > 0) {
+                    busWrite(&cont, 1);
+                }
+                busWrite(&cmdList[i], 1);
+            }
+            busWrite(&mode, 1);
+            room -= 2 * sizeof(cmdList);
+        } else {
+            const bool restart = (_addressing == ST7315_ADDRESSING_REPEATED_START);
+
+            busBegin(ST7315_MODE_COMMAND);
+            busWrite(cmdList, sizeof(cmdList));
+            busEnd(!restart);
+            if (!restart) {
+                return true;
+            }
+            // The first data chunk follows the repeated START
+            busBegin(ST7315_MODE_DATA);
+        }
+    } else {
+        busBegin(ST7315_MODE_DATA);
+    }
+
+    const size_t rowLen = _win.x1 - _win.x0 + 1;
+    const size_t start  = room;
+
+    // Chunks may span page boundaries to keep transactions full
+    while (room > 0 && _winPage <= _win.page1) {
+        uint8_t block[8];
+        size_t chunkSize       = min(room, rowLen - _winCol);
+        const uint8_t *data    = panelBytes(_winPage, _win.x0 + _winCol, chunkSize, block);
+        const size_t written   = busWrite(data, chunkSize);
+
+        if (_shadow) {
+            const size_t offset = data - _buffer;
+            memcpy(&_shadow[offset], data, written);
+        }
+
+        room    -= written;
+        _winCol += written;
+        if (_winCol == rowLen) {
+            _winCol = 0;
+            _winPage++;
+        }
+
+        // Wire buffer full: the rest goes out with the next transaction
+        if (written < chunkSize) {
+            break;
+        }
+    }
+    busEnd();
+
+    // Wire accepts no data at all, give up on the window rather than spin
+    if (room == start) {
+        _winActive = false;
+    }
+
+    if (_winPage > _win.page1) {
+        _winActive = false;
+    }
+    return true;
+}
+
+// Panel bytes of `page` from column x on, n of them at most (n is updated).
+// Rotated by a quarter turn, the 8x8 block holding column x is converted into `block`:
+// it comes from logical columns [8 * page, 8 * page + 8) of one logical page,
+// the rightmost panel column holding the first logical row.
+const uint8_t *Arduino_ST7315_Driver::panelBytes(int page, int x, size_t &n, uint8_t block[8]) const
+{
+    if (!(_rotation & 1)) {
+        return &_buffer[(page - _bandPage0) * _panelWidth + x];
+    }
+
+    const int logicalPage = _panelWidth / 8 - 1 - x / 8;
+    transpose8(&_buffer[logicalPage * _width + page * 8], block);
+
+    n = min(n, (size_t)(8 - (x & 7)));
+    return &block[x & 7];
+}
+
+void Arduino_ST7315_Driver::setTransferSize(size_t bytes)
+{
+    _transferSize = constrain(bytes, (size_t)ST7315_MIN_TRANSFER_SIZE, _bus->maxTransferSize());
+}
+
+size_t Arduino_ST7315_Driver::addressingCost() const
+{
+    switch (_addressing) {
+    case ST7315_ADDRESSING_CONTINUATION:
+        return _bus->controlBytes() ? ST7315_COST_ADDRESSING_CO : ST7315_COST_ADDRESSING;
+    case ST7315_ADDRESSING_REPEATED_START:
+        return ST7315_COST_ADDRESSING_SR;
+    default:
+        return ST7315_COST_ADDRESSING;
+    }
+}
+
+size_t Arduino_ST7315_Driver::windowCost(int x0, int x1, int pages) const
+{
+    const size_t maxPayload = _transferSize - 1;
+    const size_t bytes      = (x1 - x0 + 1) * pages;
+    const size_t chunks     = (bytes + maxPayload - 1) / maxPayload;
+
+    return addressingCost() + bytes + chunks * ST7315_COST_TRANSACTION;
+}
+
+size_t Arduino_ST7315_Driver::fullFrameBytes() const
+{
+    const size_t maxPayload = _transferSize - 1;
+    const size_t bytes      = (_width * _height) / 8;
+
+    // Addressing command list, frame data, one control byte per data chunk
+    if (_addressing == ST7315_ADDRESSING_CONTINUATION && _bus->controlBytes()) {
+        const size_t rest = bytes - min(bytes, maxPayload - 2 * 6);
+        return (2 * 6 + 1) + bytes + (rest + maxPayload - 1) / maxPayload;
+    }
+    return (1 + 6) + bytes + (bytes + maxPayload - 1) / maxPayload;
+}
+
+void Arduino_ST7315_Driver::markDirty(int page, int x0, int x1)
+{
+    // Rotated by a quarter turn: logical columns are panel rows, and a logical
+    // page is an 8 column block of the panel, converted whole at flush time
+    if (_rotation & 1) {
+        const int col = _panelWidth - 8 - page * 8;
+        for (int p = x0 / 8; p <= x1 / 8; p++) {
+            _dirtyX0[p] = min<int>(_dirtyX0[p], col);
+            _dirtyX1[p] = max<int>(_dirtyX1[p], col + 7);
+        }
+        return;
+    }
+
+    if (x0 < _dirtyX0[page]) {
+        _dirtyX0[page] = x0;
+    }
+    if (x1 > _dirtyX1[page]) {
+        _dirtyX1[page] = x1;
     }
 }
 
 void Arduino_ST7315_Driver::command(uint8_t c)
 {
-    _wire->beginTransmission(_address);
-    _wire->write(ST7315_MODE_COMMAND);
-    _wire->write(c);
-    _wire->endTransmission();
+    busBegin(ST7315_MODE_COMMAND);
+    busWrite(&c, 1);
+    busEnd();
 }
 
 void Arduino_ST7315_Driver::commandList(const uint8_t *cmds, uint8_t n)
 {
-    const size_t maxPayload = WIRE_MAX_BUF_LEN - 1; // Reserve 1 byte for command byte
+    const size_t maxPayload = _transferSize - 1; // Reserve 1 byte for command byte
 
     while (n > 0) {
         size_t chunkSize = min<size_t>(n, maxPayload);
 
-        _wire->beginTransmission(_address);
-        _wire->write(ST7315_MODE_COMMAND);
-        _wire->write(cmds, chunkSize);
-        _wire->endTransmission();
+        busBegin(ST7315_MODE_COMMAND);
+        size_t written = busWrite(cmds, chunkSize);
+        busEnd();
+
+        if (!written) {
+            return;
+        }
+        cmds += written;
+        n    -= written;
+    }
+}
+
+const Arduino_ST7315_Stats &Arduino_ST7315_Driver::stats() const
+{
+#if ST7315_STATS
+    return _stats;
+#else
+    static const Arduino_ST7315_Stats none = {};
+    return none;
+#endif
+}
+
+void Arduino_ST7315_Driver::resetStats()
+{
+#if ST7315_STATS
+    memset(&_stats, 0, sizeof(_stats));
+#endif
+}
+
+void Arduino_ST7315_Driver::setTraceHook(void (*hook)(Arduino_ST7315_Event event))
+{
+#if ST7315_STATS
+    _traceHook = hook;
+#else
+    (void)hook;
+#endif
+}
+
+// Every transfer goes through busBegin(), busWrite() and busEnd(),
+// which also keep the byte count and the statistics.
+void Arduino_ST7315_Driver::busBegin(uint8_t mode)
+{
+    // The mode costs a control byte on I2C, a pin level on SPI
+    const size_t control = _bus->controlBytes() ? 1 : 0;
 
-        cmds += chunkSize;
-        n    -= chunkSize;
+    _bus->beginTransfer(mode);
+    _busBytes += control;
+    _txBytes   = 1;
+
+#if ST7315_STATS
+    _stats.transactions++;
+    _stats.bytes += control;
+#endif
+}
+
+size_t Arduino_ST7315_Driver::busWrite(const uint8_t *data, size_t n)
+{
+    const size_t written = _bus->write(data, n);
+    _busBytes += written;
+    _txBytes  += written;
+
+#if ST7315_STATS
+    _stats.bytes += written;
+#endif
+
+    // Where the core reports a full buffer, the transaction holds what fits:
+    // later transactions are sized to match
+    if (written < n) {
+        _transferSize = max<size_t>(_txBytes, ST7315_MIN_TRANSFER_SIZE);
     }
+
+    return written;
+}
+
+// stop = false ends an I2C transaction with a repeated START, the bus stays claimed
+// for the next transaction.
+void Arduino_ST7315_Driver::busEnd(bool stop)
+{
+    const uint8_t status = _bus->endTransfer(stop);
+
+#if ST7315_STATS
+    if (status) {
+        _stats.errors[(status <= 5) ? status : 4]++;
+    }
+#else
+    (void)status;
+#endif
 }
\ No newline at end of file
@@ -9,6 +9,134 @@
 #define _ARDUINO_ST7315_DRIVER_H
 
 #include <Wire.h>
+#include "Arduino_ST7315_Config.h"
+#include "Arduino_ST7315_Bus.h"
+
+#define ST7315_MAX_PAGES    8   // Up to 64 rows, 8 rows per page
+
+// ST7315 Commands
+#define ST7315_DISPLAYOFF          0xAE
+#define ST7315_DISPLAYON           0xAF
+#define ST7315_COLUMNADDR          0x21
+#define ST7315_PAGEADDR            0x22
+#define ST7315_SETDISPLAYCLOCKDIV  0xD5
+#define ST7315_SETMULTIPLEX        0xA8
+#define ST7315_SETDISPLAYOFFSET    0xD3
+#define ST7315_SETSTARTLINE        0x40
+#define ST7315_CHARGEPUMP          0x8D
+#define ST7315_MEMORYMODE          0x20
+#define ST7315_SEGREMAP            0xA1
+#define ST7315_SEGREMAP_OFF        0xA0
+#define ST7315_COMSCANDEC          0xC8
+#define ST7315_COMSCANINC          0xC0
+#define ST7315_SETPRECHARGE        0xD9
+#define ST7315_SETVCOMDETECT       0xDB
+#define ST7315_DISPLAYALLON_RESUME 0xA4
+#define ST7315_NORMALDISPLAY       0xA6
+#define ST7315_SET_CONTRAST        0x81
+#define ST7315_SET_COM_PINS        0xDA
+#define SSD1306_DEACTIVATE_SCROLL  0x2E
+#define SSD1306_DISPLAYALLON_RESUME 0xA4
+#define SSD1306_RIGHT_HORIZONTAL_SCROLL              0x26
+#define SSD1306_LEFT_HORIZONTAL_SCROLL               0x27
+#define SSD1306_VERTICAL_AND_RIGHT_HORIZONTAL_SCROLL 0x29
+#define SSD1306_VERTICAL_AND_LEFT_HORIZONTAL_SCROLL  0x2A
+#define SSD1306_ACTIVATE_SCROLL                      0x2F
+#define SSD1306_SET_VERTICAL_SCROLL_AREA             0xA3
+
+// Continuous scroll step intervals, in frames
+#define ST7315_SCROLL_2FRAMES      0x07
+#define ST7315_SCROLL_3FRAMES      0x04
+#define ST7315_SCROLL_4FRAMES      0x05
+#define ST7315_SCROLL_5FRAMES      0x00
+#define ST7315_SCROLL_25FRAMES     0x06
+#define ST7315_SCROLL_64FRAMES     0x01
+#define ST7315_SCROLL_128FRAMES    0x02
+#define ST7315_SCROLL_256FRAMES    0x03
+
+// COM pins hardware configuration by geometry:
+// sequential COM pins on 16 and 32 rows panels, alternative COM pins otherwise
+#define ST7315_COM_PINS_CONFIG(height)  (((height) == 16 || (height) == 32) ? 0x02 : 0x12)
+
+// Init sequence, shared by the runtime driver and the constexpr table of Arduino_ST7315_DriverT
+#define ST7315_INIT_SEQUENCE(height) \
+    ST7315_DISPLAYOFF,                  /* 0xAE: Display OFF during setup */ \
+    ST7315_SETDISPLAYCLOCKDIV, 0x80,    /* 0xD5 0x80: Set display clock divide ratio / oscillator frequency */ \
+    ST7315_SETMULTIPLEX, (uint8_t)((height) - 1),   /* 0xA8 0x3F: Multiplex ratio = (Display height - 1) */ \
+    ST7315_SETDISPLAYOFFSET, 0x00,      /* 0xD3 0x00: Display offset = 0 (no vertical shift) */ \
+    ST7315_SETSTARTLINE | 0x00,         /* 0x40: Set display start line at 0 */ \
+    ST7315_CHARGEPUMP, 0x14,            /* 0x8D 0x14: Enable charge pump (internal DC-DC 0x14 / external 0x10) */ \
+    ST7315_MEMORYMODE, 0x00,            /* 0x20 0x00: Set memory addressing mode to horizontal addressing */ \
+    ST7315_SEGREMAP,                    /* 0xA1: Segment remap (flip horizontal direction) */ \
+    ST7315_COMSCANDEC,                  /* 0xC8: COM output scan direction = remapped (flip vertical direction) */ \
+    ST7315_SET_COM_PINS, (uint8_t)ST7315_COM_PINS_CONFIG(height),  /* 0xDA 0x12: COM pins hardware configuration */ \
+    ST7315_SET_CONTRAST, 0x7F,          /* 0x81 0x7F: Set contrast (FIXME: may need adjustment according to voltage supply and display size) */ \
+    ST7315_SETPRECHARGE, 0xF1,          /* 0xD9 0xF1: Set pre-charge period for stable pixel voltage (FIXME: may need adjustment according to voltage supply) */ \
+    ST7315_SETVCOMDETECT, 0x20,         /* 0xDB 0x20: Set VCOMH deselect level (for contrast stabilization) */ \
+    SSD1306_DISPLAYALLON_RESUME,        /* 0xA4: Resume to RAM content display */ \
+    ST7315_NORMALDISPLAY,               /* 0xA6: Set normal display mode (not inverted) */ \
+    SSD1306_DEACTIVATE_SCROLL           /* 0x2E: Deactivate scroll if previously enabled */
+
+// Raster operations for blit(): how source bits are combined with the framebuffer
+enum Arduino_ST7315_RasterOp {
+    ST7315_OP_COPY,     // dst = src
+    ST7315_OP_OR,       // dst |= src
+    ST7315_OP_AND,      // dst &= src
+    ST7315_OP_XOR,      // dst ^= src
+    ST7315_OP_NOT       // dst = ~src
+};
+
+// Memory layouts of packed 1bpp bitmaps
+enum Arduino_ST7315_BitmapLayout {
+    ST7315_BITMAP_ROWS,     // Row-major, MSB is the leftmost pixel, rows padded to whole bytes
+    ST7315_BITMAP_PAGES     // Native page-major, one byte per column per 8 rows, LSB on top
+};
+
+// Screen rotations, clockwise
+enum Arduino_ST7315_Rotation {
+    ST7315_ROTATION_0,
+    ST7315_ROTATION_90,
+    ST7315_ROTATION_180,
+    ST7315_ROTATION_270
+};
+
+// How a sprite is drawn over the background and taken off it again
+enum Arduino_ST7315_SpriteMode {
+    ST7315_SPRITE_XOR,          // Drawn and erased with XOR: no extra RAM, inverts what is underneath
+    ST7315_SPRITE_SAVE_UNDER    // Set bits drawn on, the background under the sprite is saved and restored
+};
+
+// How update() sends the column/page addressing of each window
+enum Arduino_ST7315_Addressing {
+    ST7315_ADDRESSING_SEPARATE,         // Own transaction
+    ST7315_ADDRESSING_CONTINUATION,     // Same transaction as the first data chunk, through the Co bit (I2C only)
+    ST7315_ADDRESSING_REPEATED_START,   // Own transaction ended by a repeated START, first data chunk follows at once
+};
+
+// Trace hook events, see Arduino_ST7315_Driver::setTraceHook()
+enum Arduino_ST7315_Event {
+    ST7315_EVENT_RENDER_BEGIN,
+    ST7315_EVENT_RENDER_END,
+    ST7315_EVENT_FLUSH_BEGIN,   // A flush pass starts sending the dirty areas
+    ST7315_EVENT_FLUSH_END      // Last transaction of the pass sent
+};
+
+// Runtime counters kept by Arduino_ST7315_Driver, all zero unless ST7315_STATS
+// is set in Arduino_ST7315_Config.h
+struct Arduino_ST7315_Stats {
+    uint32_t frames;                // Flush passes completed
+    uint32_t bytes;                 // Bytes sent, control bytes included
+    uint32_t transactions;
+    uint32_t errors[6];             // Failed endTransmission() by return code: 1 too long, 2 address NACK,
+                                    // 3 data NACK, 4 other, 5 timeout (index 0 unused)
+    uint32_t updateMicrosMax;       // Longest flush pass, time spent in the poll() calls sending it
+                                    // (asynchronous flushes: not the idle time between the calls)
+    uint32_t updateMicrosTotal;
+    uint32_t pixels;                // Pixels drawn since the current frame started
+    uint32_t framePixels;           // Pixels drawn into the last frame flushed
+
+    uint32_t updateMicrosAverage() const { return frames ? updateMicrosTotal / frames : 0; }
+};
 
 // @class Arduino_ST7315_Driver
 // @brief Low-level driver for the ST7315 OLED display.
@@ -26,25 +154,344 @@ public:
         uint8_t address = 0x3D
     );
 
+    // Any other transport, e.g. Arduino_ST7315_SPIBus. The bus must outlive the driver.
+    Arduino_ST7315_Driver(int width, int height, Arduino_ST7315_Bus *bus);
+
     ~Arduino_ST7315_Driver();
 
+    // Fails for a panel wider than 128 columns, or a height that is not a
+    // multiple of 8 rows from 8 to 64
     int begin();
     void end();
 
+    // Drawing surface, height x width of the panel when rotated by 90 or 270 degrees
+    int width() const { return _width; }
+    int height() const { return _height; }
+
+    // 0 and 180 degrees flip the controller segment and COM scan directions, at no CPU
+    // cost. 90 and 270 degrees keep a rotated framebuffer, converted to the panel page
+    // layout at flush time, 8x8 pixel blocks at a time and only where dirty; they need a
+    // panel width multiple of 8 and rule out the start line, diff updates and page bands.
+    // Changing between these two groups clears the screen. Returns 0 when not available.
+    int setRotation(Arduino_ST7315_Rotation rotation);
+    Arduino_ST7315_Rotation rotation() const { return (Arduino_ST7315_Rotation)_rotation; }
+
     void set(int x, int y, bool on);
+    bool get(int x, int y) const;   // Pixel read-back, false outside the screen (or the current band)
     void clear();
+
+    // Bulk primitives, built from byte masks and memset across pages
+    void fillRect(int x, int y, int w, int h, bool on);
+    void fillScreen(bool on);
+    void drawHLine(int x, int y, int w, bool on) { fillRect(x, y, w, 1, on); }
+    void drawVLine(int x, int y, int h, bool on) { fillRect(x, y, 1, h, on); }
+
+    // Draw a packed 1bpp bitmap with its top-left corner at (x, y), clipped to the screen
+    void blit(const uint8_t *data, int x, int y, int w, int h,
+              Arduino_ST7315_BitmapLayout layout = ST7315_BITMAP_PAGES,
+              Arduino_ST7315_RasterOp op = ST7315_OP_COPY);
+
+    // Draw an image compressed by extras/tools/st7315_imgconv.py --rle, with its top-left
+    // corner at (x, y): width and height bytes, then the page-major bitmap as runs. A control
+    // byte c < 0x80 is followed by c + 1 literal bytes, c >= 0x80 by one byte repeated
+    // c - 0x7E times (2 to 129). Runs are decoded straight into the framebuffer,
+    // clipped like blit() (to the current band in page-band mode).
+    void blitRLE(const uint8_t *data, int x, int y, Arduino_ST7315_RasterOp op = ST7315_OP_COPY);
+
+    // Sprites: 1bpp bitmaps with a position, kept over the background drawn with
+    // the other primitives. Moving a sprite only touches (and marks dirty) its old
+    // and new rectangles, so animations do not redraw or resend the whole frame.
+    // Draw under a sprite while it is hidden; save-under sprites must not overlap
+    // each other. clear() and fillScreen() wipe the sprites, moveSprite() shows them
+    // again. The bitmap data must outlive the sprite. Not available in page-band mode.
+    // addSprite() returns the sprite id, or -1 when no slot or RAM is left.
+    int addSprite(const uint8_t *data, int w, int h,
+                  Arduino_ST7315_SpriteMode mode = ST7315_SPRITE_XOR,
+                  Arduino_ST7315_BitmapLayout layout = ST7315_BITMAP_PAGES);
+    void moveSprite(int id, int x, int y);  // Show the sprite with its top-left corner at (x, y)
+    void hideSprite(int id);
+    void removeSprite(int id);
+    bool spriteVisible(int id) const;
+
     void update();
+    void invalidate();  // Mark the whole screen dirty, next update() sends the full frame
+
+    // Diff update mode: keep a copy of the last frame sent to the panel and
+    // only transfer the byte runs that changed. Costs an extra framebuffer of RAM.
+    // Returns 0 if the shadow buffer cannot be allocated.
+    int setDiffUpdate(bool enable);
+
+    // Non-blocking flush: beginUpdate() plans the transfer of the dirty areas,
+    // then every poll() sends at least one transaction and keeps going until
+    // maxBytes bus bytes or maxMicros microseconds are spent. 0 leaves either one
+    // unlimited when the other is given; poll() with no budget sends one transaction.
+    // Drawing while busy is allowed: areas changed after being sent are marked
+    // dirty again and go out with the next update. The onUpdateComplete() callback
+    // runs from poll() once the bus is released, so it may use the bus itself.
+    void beginUpdate();
+    bool poll(size_t maxBytes = 0, unsigned long maxMicros = 0);   // Returns true while still busy
+    bool isBusy() const { return _busy; }
+    void onUpdateComplete(void (*callback)()) { _onUpdateComplete = callback; }
+
+    // Continuous scroll of pages [page0, page1], run by the controller with no bus traffic.
+    // The GDDRAM must not be written while scrolling: update() keeps the dirty areas
+    // until stopScroll(), which also schedules a full refresh as the controller requires.
+    void startScrollRight(uint8_t page0, uint8_t page1, uint8_t interval = ST7315_SCROLL_5FRAMES);
+    void startScrollLeft(uint8_t page0, uint8_t page1, uint8_t interval = ST7315_SCROLL_5FRAMES);
+    void startScrollDiagRight(uint8_t page0, uint8_t page1, uint8_t verticalOffset, uint8_t interval = ST7315_SCROLL_5FRAMES);
+    void startScrollDiagLeft(uint8_t page0, uint8_t page1, uint8_t verticalOffset, uint8_t interval = ST7315_SCROLL_5FRAMES);
+    void stopScroll();
+    bool isScrolling() const { return _scrolling; }
+
+    // Vertical offset through the display start line. Drawing coordinates stay
+    // on screen coordinates: the framebuffer is stored in GDDRAM order, shifted by
+    // the start line, so moving it only costs the rows that come into view.
+    // scrollVertical() moves the content up (dy > 0) or down (dy < 0) and fills the
+    // rows that come into view. The new start line is sent by the next update().
+    void setStartLine(int line);
+    int startLine() const { return _startLine; }
+    void scrollVertical(int dy, bool on = false);
+
+    // Bytes per transfer, control byte included. Over I2C it defaults to the Wire
+    // buffer size of the core. A larger size shrinks to what Wire accepts: the first
+    // transactions of each length are written byte by byte to find out.
+    void setTransferSize(size_t bytes);
+    size_t transferSize() const { return _transferSize; }
+
+    // Packing the addressing into the data transaction saves a START, STOP and
+    // address byte per window, but the Co bit costs a control byte per command
+    // (5 more bytes per window). extras/test/benchmark compares them.
+    void setAddressing(Arduino_ST7315_Addressing mode) { _addressing = mode; }
+    Arduino_ST7315_Addressing addressing() const { return _addressing; }
+
+    size_t lastUpdateBytes() const { return _lastUpdateBytes; }  // Bytes written to the bus by the last update()
+    size_t lastUpdateSaved() const { return _lastUpdateSaved; }  // Bytes saved by the last update() versus a full frame
+
+    // Page-band mode for low-RAM boards: the driver keeps only a band of `pages` pages
+    // (width bytes each) instead of the whole framebuffer, and the screen is drawn one
+    // band at a time. Drawing is clipped to the current band, so the same drawing code
+    // runs once per band; fewer, taller bands trade RAM for redraws. 0 goes back to
+    // the full framebuffer. Not available with diff updates or Arduino_ST7315_DriverT.
+    // Returns 0 if the buffer cannot be allocated, the current mode is then kept;
+    // after begin(), both buffers are held while swapping them.
+    int setBandPages(uint8_t pages);
+    uint8_t bandPages() const { return _bandPages; }
+
+    // Picture loop: every band starts cleared and is sent as soon as it is drawn.
+    //   firstBand(); do { ...draw... } while (nextBand());
+    // With the full framebuffer this is a single pass followed by update().
+    void firstBand();
+    bool nextBand();
+    void drawBands(void (*draw)());     // Same loop, calls draw() once per band
+
+    // Render begin/end around the drawing of a frame, reported to the trace hook.
+    // Called by Arduino_ST7315 beginDraw()/endDraw() and by the band loop.
+    void renderBegin() { trace(ST7315_EVENT_RENDER_BEGIN); }
+    void renderEnd() { trace(ST7315_EVENT_RENDER_END); }
+
+    // Without ST7315_STATS, stats() stays at zero and the trace hook is never called
+    const Arduino_ST7315_Stats &stats() const;
+    void resetStats();
+    // Called on render and flush begin/end, e.g. to feed an external tracer
+    void setTraceHook(void (*hook)(Arduino_ST7315_Event event));
+
+    // Raw framebuffer in GDDRAM order, e.g. to check it against the panel content
+    // (the current band only in page-band mode, drawing order when rotated by 90 or 270 degrees)
+    const uint8_t *framebuffer() const { return _buffer; }
+
+protected:
+    // Used by Arduino_ST7315_DriverT: caller-owned framebuffer and precomputed init sequence
+    // bus = nullptr selects I2C on wire/address
+    Arduino_ST7315_Driver(int width, int height, TwoWire *wire, uint8_t address, Arduino_ST7315_Bus *bus,
+                          uint8_t *buffer, const uint8_t *initCmds, uint8_t initLen);
+
+    void markDirty(int page, int x0, int x1);
+
+    uint8_t     _startLine;                     // Display start line, GDDRAM row of screen row 0
+    uint8_t     _rotation;                      // Arduino_ST7315_Rotation
+
+    void trace(Arduino_ST7315_Event event)
+    {
+#if ST7315_STATS
+        if (_traceHook) {
+            _traceHook(event);
+        }
+#else
+        (void)event;
+#endif
+    }
+
+    // ST7315_STATS comes from Arduino_ST7315_Config.h only, so the library and the
+    // sketches agree on the class layout
+#if ST7315_STATS
+    Arduino_ST7315_Stats _stats;
+    void        (*_traceHook)(Arduino_ST7315_Event event);
+    unsigned long _passMicros;                  // Time spent sending the current flush pass so far
+#endif
 
 private:
     void command(uint8_t c);
     void commandList(const uint8_t *cmds, uint8_t n);
+    void busBegin(uint8_t mode);
+    size_t busWrite(const uint8_t *data, size_t n);
+    void busEnd(bool stop = true);
+
+    void fillRectPhys(int x, int y, int w, int h, bool on);
+    void blitPhys(const uint8_t *data, int x, int y, int w, int h,
+                  Arduino_ST7315_BitmapLayout layout, Arduino_ST7315_RasterOp op,
+                  int clipY0, int clipY1);
+    const uint8_t *panelBytes(int page, int x, size_t &n, uint8_t block[8]) const;
+    void startBand();
+    void startScroll(uint8_t cmd, uint8_t page0, uint8_t page1, uint8_t interval, int verticalOffset);
+
+    size_t addressingCost() const;
+    size_t windowCost(int x0, int x1, int pages) const;
+    size_t fullFrameBytes() const;
+
+    struct Sprite {
+        const uint8_t *data;    // Bitmap, nullptr for a free slot
+        uint8_t *saved;         // Background under the sprite, page-major (save-under mode only)
+        int16_t x, y;
+        uint8_t w, h;
+        Arduino_ST7315_SpriteMode mode;
+        Arduino_ST7315_BitmapLayout layout;
+        bool    drawn;          // Currently in the framebuffer at (x, y)
+    };
+    Sprite *sprite(int id);
+    void drawSprite(Sprite &s);
+    void eraseSprite(Sprite &s);
+
+    struct Window {
+        uint8_t x0, x1;         // Column range
+        uint8_t page0, page1;   // Page range
+    };
+
+    void startPass();
+    void finishPass();
+    void planWindows();
+    bool nextWindow(Window &w);
+    bool sendChunk();
 
 private:
-    int         _width;
+    int         _width;                         // Drawing surface
     int         _height;
-    TwoWire     *_wire;
-    uint8_t     _address;
+    int         _panelWidth;                    // Controller columns and rows
+    int         _panelHeight;
+    Arduino_ST7315_I2CBus _i2c;                 // Default transport
+    Arduino_ST7315_Bus *_bus;
     uint8_t     *_buffer;
+    bool        _staticBuffer;                  // _buffer is not owned by the driver
+    uint8_t     _bandPages;                     // Pages per band, 0 for a full framebuffer
+    uint8_t     _bandPage0;                     // GDDRAM pages held in _buffer: [_bandPage0, _bandPageEnd)
+    uint8_t     _bandPageEnd;
+    const uint8_t *_initCmds;                   // Precomputed init sequence, nullptr to build it in begin()
+    uint8_t     _initLen;
+    uint8_t     _dirtyX0[ST7315_MAX_PAGES];    // First dirty column per page (> _dirtyX1 when clean)
+    uint8_t     _dirtyX1[ST7315_MAX_PAGES];    // Last dirty column per page
+    uint8_t     *_shadow;                       // Last frame sent to the panel (diff update mode only)
+    bool        _shadowValid;                   // False until the shadow matches the panel GDDRAM
+    size_t      _busBytes;                      // Bytes written to the bus, including control bytes
+    size_t      _transferSize;                  // Bytes per transaction, including control bytes
+    size_t      _txBytes;                       // Bytes in the current transaction
+    Arduino_ST7315_Addressing _addressing;
+    size_t      _lastUpdateBytes;
+    size_t      _lastUpdateSaved;
+
+    // Flush state machine
+    size_t      _passBusBytes;                  // _busBytes when the current pass started
+    bool        _busy;
+    bool        _updatePending;                 // beginUpdate() called while busy
+    void        (*_onUpdateComplete)();
+    Window      _plan[ST7315_MAX_PAGES];        // Windows planned by planWindows()
+    uint8_t     _planCount;
+    uint8_t     _planIndex;
+    bool        _planDiff;                      // Runs are found lazily against the shadow buffer
+    uint8_t     _planX0[ST7315_MAX_PAGES];      // Dirty columns snapshot for the diff scan
+    uint8_t     _planX1[ST7315_MAX_PAGES];
+    uint8_t     _scanPage;
+    uint8_t     _scanX;
+    Window      _win;                           // Window being sent
+    bool        _winActive;
+    uint8_t     _winPage;
+    uint8_t     _winCol;
+
+    Sprite      _sprites[ST7315_MAX_SPRITES];
+
+    bool        _scrolling;                     // Continuous scroll running, GDDRAM is locked
+    bool        _startLinePending;              // Start line changed, sent at the end of the next pass
+    bool        _remapPending;                  // Half-turn rotation changed, sent at the end of the next pass
+};
+
+// @struct Arduino_ST7315_InitTable
+// @brief Init sequence of a W x H panel, computed at compile time.
+
+template <int W, int H>
+struct Arduino_ST7315_InitTable
+{
+    static constexpr uint8_t cmds[] = { ST7315_INIT_SEQUENCE(H) };
+};
+
+template <int W, int H>
+constexpr uint8_t Arduino_ST7315_InitTable<W, H>::cmds[];
+
+// @class Arduino_ST7315_DriverT
+// @inherits Arduino_ST7315_Driver
+// @brief Compile-time sized variant of the low-level driver.
+// The framebuffer is a member array, so begin() never allocates memory,
+// and set() indexes it with constant geometry.
+
+template <int W, int H>
+class Arduino_ST7315_DriverT : public Arduino_ST7315_Driver
+{
+    static_assert(W > 0 && W <= 128, "ST7315 panels have up to 128 columns");
+    static_assert(H >= 8 && H <= ST7315_MAX_PAGES * 8 && (H % 8) == 0, "ST7315 panel height must be a multiple of 8, up to 64 rows");
+
+public:
+    Arduino_ST7315_DriverT(TwoWire *wire = &Wire1, uint8_t address = 0x3D)
+        : Arduino_ST7315_Driver(W, H, wire, address, nullptr, _frame,
+                                Arduino_ST7315_InitTable<W, H>::cmds,
+                                sizeof(Arduino_ST7315_InitTable<W, H>::cmds))
+    {
+    }
+
+    Arduino_ST7315_DriverT(Arduino_ST7315_Bus *bus)
+        : Arduino_ST7315_Driver(W, H, nullptr, 0, bus, _frame,
+                                Arduino_ST7315_InitTable<W, H>::cmds,
+                                sizeof(Arduino_ST7315_InitTable<W, H>::cmds))
+    {
+    }
+
+    void set(int x, int y, bool on)
+    {
+        // The constant geometry below is the panel one
+        if (this->_rotation & 1) {
+            Arduino_ST7315_Driver::set(x, y, on);
+            return;
+        }
+        if ((unsigned)x >= W || (unsigned)y >= H) {
+            return;
+        }
+
+        y += this->_startLine;
+        if (y >= H) {
+            y -= H;
+        }
+
+        uint8_t &b   = _frame[x + (y >> 3) * W];
+        uint8_t  old = b;
+        uint8_t  bit = 1 << (y & 7);
+
+        b = on ? (b | bit) : (b & ~bit);
+#if ST7315_STATS
+        this->_stats.pixels++;
+#endif
+        if (b != old) {
+            markDirty(y >> 3, x, x);
+        }
+    }
+
+private:
+    uint8_t _frame[(W * H) / 8];
 };
 
 #endif // _ARDUINO_ST7315_DRIVER_H
\ No newline at end of file